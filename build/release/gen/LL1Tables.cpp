@@ -0,0 +1,388 @@
+// Generated by scripts/gen_ll1.py from grammar/pooLL1.y, do not edit
+// 40 nonterminals, 134 productions
+#include "LL1Tables.h"
+
+namespace ll1 {
+
+static_assert(TAG_COUNT == 56, "Tag changed since the table was generated");
+
+const int START = 57;  // program
+
+const int16_t PREDICT[] = {
+    // program
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,  -1,
+    // elements
+      1,   1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,   1,   1,   1,   1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // moreElements
+      2,   2,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+      3,   3,   3,   3,   3,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3,
+      3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+      3,   3,   3,   3,   3,   3,   3,   3,   3,
+    // element
+      4,   5,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,   5,   5,   5,   5,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // classDef
+      6,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // inheritance
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,   8,  -1,  -1,   7,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // moreParents
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,   9,  -1,  -1,  10,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // classBody
+     -1,  11,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  11,  11,  11,  11,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  12,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // moreMethodDefs
+     -1,  13,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  13,  13,  13,  13,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  14,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // methodDef
+     -1,  19,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  16,  17,  15,  18,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // methodDefRaw
+     -1,  20,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // methodDefSelf
+     -1,  21,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // methodDefCls
+     -1,  22,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // methodDefTail
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  23,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  23,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // methodName
+     -1,  -1,  -1,  24,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  25,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // paramList
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  27,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  26,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // moreParams
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  28,  -1,  -1,  29,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // parameter
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  30,  -1,  -1,  -1,  -1,  -1,  -1,
+     30,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // paramName
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  31,  -1,  -1,  -1,  -1,  -1,  -1,
+     32,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // starredName
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  33,  -1,  -1,  -1,  -1,  -1,  -1,
+     34,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // typeHint
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  35,  36,  -1,  -1,  36,  -1,
+     -1,  -1,  -1,  36,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // typeExpr
+     -1,  -1,  -1,  -1,  -1,  38,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  40,  -1,  -1,  41,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  37,  37,  -1,  39,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // moreTypeName
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  43,  43,  42,  -1,  43,  43,
+     43,  -1,  -1,  43,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // typeNamePart
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  44,  45,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // typeArguments
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  47,  47,  -1,  -1,  47,  46,
+     47,  -1,  -1,  47,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // typeItems
+     -1,  -1,  -1,  -1,  -1,  48,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  48,  -1,  -1,  48,
+     49,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  48,  48,  -1,  48,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // typeList
+     -1,  -1,  -1,  -1,  -1,  50,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  50,  -1,  -1,  50,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  50,  50,  -1,  50,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // moreTypes
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  51,  -1,  -1,  -1,  -1,
+     52,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // defaultValue
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  54,  -1,  -1,  54,  -1,
+     -1,  -1,  -1,  53,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // returnType
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  56,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  55,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // preSkipStatements
+     58,  58,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+     57,  57,  57,  57,  57,  58,  58,  58,  58,  57,  57,  57,  57,  57,  57,  57,
+     57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+     57,  57,  57,  57,  57,  57,  57,  57,  -1,
+    // postSkipStatements
+     -1,  -1,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,
+     59,  59,  59,  59,  59,  -1,  -1,  -1,  -1,  59,  59,  59,  59,  59,  59,  59,
+     59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,  59,
+     59,  59,  59,  59,  59,  59,  59,  59,  60,
+    // anyTokens
+     62,  62,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+     61,  61,  61,  61,  61,  62,  62,  62,  62,  61,  61,  61,  61,  61,  61,  61,
+     61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,  61,
+     61,  61,  61,  61,  61,  61,  61,  61,  63,
+    // methodBody
+     64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+     64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+     64,  64,  64,  64,  64,  65,  66,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+     64,  64,  64,  64,  64,  64,  64,  64,  -1,
+    // skipDefault
+     67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+     67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  68,  67,  67,  68,  67,
+     67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+     67,  67,  67,  67,  67,  67,  67,  67,  -1,
+    // nonStartToken
+     -1,  -1,  69,  69,  69,  69,  69,  69,  69,  69,  69,  69,  69,  69,  69,  69,
+     69,  69,  69,  69,  69,  -1,  -1,  -1,  -1,  69,  69,  72,  69,  69,  73,  69,
+     69,  69,  69,  69,  69,  70,  71,  69,  69,  69,  69,  69,  69,  69,  69,  69,
+     69,  69,  69,  69,  69,  69,  69,  69,  -1,
+    // bodyToken
+     75,  75,  74,  74,  74,  74,  74,  74,  74,  74,  74,  74,  74,  74,  74,  74,
+     74,  74,  74,  74,  74,  75,  75,  75,  75,  74,  74,  76,  74,  74,  77,  74,
+     74,  74,  74,  74,  74,  -1,  -1,  74,  74,  74,  74,  74,  74,  74,  74,  74,
+     74,  74,  74,  74,  74,  74,  74,  74,  -1,
+    // defaultToken
+     79,  79,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,  78,
+     78,  78,  78,  78,  78,  79,  79,  79,  79,  78,  78,  -1,  78,  78,  -1,  78,
+     78,  78,  78,  78,  78,  80,  81,  78,  78,  78,  78,  78,  78,  78,  78,  78,
+     78,  78,  78,  78,  78,  78,  78,  78,  -1,
+    // startToken
+     82,  83,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  84,  85,  86,  87,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+     -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,  -1,
+    // otherToken
+     -1,  -1,  88,  89,  90,  91,  92,  93,  94,  95,  96,  97,  98,  99, 100, 101,
+    102, 103, 104, 105, 106,  -1,  -1,  -1,  -1, 107, 108,  -1, 109, 110,  -1, 111,
+    112, 113, 114, 115, 116,  -1,  -1, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+    126, 127, 128, 129, 130, 131, 132, 133,  -1,
+};
+
+// Right-hand sides in reverse, ready to be pushed
+const int16_t RHS[] = {
+    88, 58, 87,  // 0: program -> preSkipStatements elements postSkipStatements
+    59, 60,  // 1: elements -> element moreElements
+    59, 60,  // 2: moreElements -> element moreElements
+    61,  // 4: element -> classDef
+    66,  // 5: element -> methodDef
+    38, 64, 37, 39, 26, 62, 41, 0,  // 6: classDef -> CLASS VARIABLE inheritance COLON NEWLINE INDENT classBody DEDENT
+    30, 63, 41, 29,  // 7: inheritance -> OPEN_PARENTHESIS VARIABLE moreParents CLOSE_PARENTHESIS
+    63, 41, 27,  // 9: moreParents -> COMMA VARIABLE moreParents
+    65, 66,  // 11: classBody -> methodDef moreMethodDefs
+    65, 66,  // 13: moreMethodDefs -> methodDef moreMethodDefs
+    69, 39, 23,  // 15: methodDef -> CLASSMETHOD NEWLINE methodDefCls
+    68, 39, 21,  // 16: methodDef -> PROPERTY NEWLINE methodDefSelf
+    67, 39, 22,  // 17: methodDef -> STATICMETHOD NEWLINE methodDefRaw
+    68, 39, 24,  // 18: methodDef -> ABSTRACTMETHOD NEWLINE methodDefSelf
+    68,  // 19: methodDef -> methodDefSelf
+    70, 30, 72, 29, 71, 1,  // 20: methodDefRaw -> DEF methodName OPEN_PARENTHESIS paramList CLOSE_PARENTHESIS methodDefTail
+    70, 30, 73, 2, 29, 71, 1,  // 21: methodDefSelf -> DEF methodName OPEN_PARENTHESIS SELF moreParams CLOSE_PARENTHESIS methodDefTail
+    70, 30, 73, 25, 29, 71, 1,  // 22: methodDefCls -> DEF methodName OPEN_PARENTHESIS CLS moreParams CLOSE_PARENTHESIS methodDefTail
+    38, 90, 37, 39, 26, 86,  // 23: methodDefTail -> returnType COLON NEWLINE INDENT methodBody DEDENT
+    3,  // 24: methodName -> INIT
+    41,  // 25: methodName -> VARIABLE
+    73, 85, 77, 41,  // 26: paramList -> VARIABLE typeHint defaultValue moreParams
+    73, 74, 27,  // 28: moreParams -> COMMA parameter moreParams
+    85, 77, 75,  // 30: parameter -> paramName typeHint defaultValue
+    41,  // 31: paramName -> VARIABLE
+    76, 48,  // 32: paramName -> MULT starredName
+    41,  // 33: starredName -> VARIABLE
+    41, 48,  // 34: starredName -> MULT VARIABLE
+    78, 26,  // 35: typeHint -> COLON typeExpr
+    81, 79, 80,  // 37: typeExpr -> typeNamePart moreTypeName typeArguments
+    5,  // 38: typeExpr -> NONE
+    43,  // 39: typeExpr -> STRING
+    28, 28, 28,  // 40: typeExpr -> DOT DOT DOT
+    32, 82, 31,  // 41: typeExpr -> OPEN_BRACKET typeItems CLOSE_BRACKET
+    79, 80, 28,  // 42: moreTypeName -> DOT typeNamePart moreTypeName
+    40,  // 44: typeNamePart -> TYPE
+    41,  // 45: typeNamePart -> VARIABLE
+    32, 83, 31,  // 46: typeArguments -> OPEN_BRACKET typeList CLOSE_BRACKET
+    83,  // 48: typeItems -> typeList
+    84, 78,  // 50: typeList -> typeExpr moreTypes
+    84, 78, 27,  // 51: moreTypes -> COMMA typeExpr moreTypes
+    91, 35,  // 53: defaultValue -> ASSIGN skipDefault
+    78, 36,  // 55: returnType -> ARROW typeExpr
+    87, 92,  // 57: preSkipStatements -> nonStartToken preSkipStatements
+    89, 92,  // 59: postSkipStatements -> nonStartToken anyTokens
+    89, 92,  // 61: anyTokens -> nonStartToken anyTokens
+    89, 95,  // 62: anyTokens -> startToken anyTokens
+    90, 93,  // 64: methodBody -> bodyToken methodBody
+    90, 38, 90, 37,  // 65: methodBody -> INDENT methodBody DEDENT methodBody
+    91, 94,  // 67: skipDefault -> defaultToken skipDefault
+    96,  // 69: nonStartToken -> otherToken
+    37,  // 70: nonStartToken -> INDENT
+    38,  // 71: nonStartToken -> DEDENT
+    27,  // 72: nonStartToken -> COMMA
+    30,  // 73: nonStartToken -> CLOSE_PARENTHESIS
+    96,  // 74: bodyToken -> otherToken
+    95,  // 75: bodyToken -> startToken
+    27,  // 76: bodyToken -> COMMA
+    30,  // 77: bodyToken -> CLOSE_PARENTHESIS
+    96,  // 78: defaultToken -> otherToken
+    95,  // 79: defaultToken -> startToken
+    37,  // 80: defaultToken -> INDENT
+    38,  // 81: defaultToken -> DEDENT
+    0,  // 82: startToken -> CLASS
+    1,  // 83: startToken -> DEF
+    21,  // 84: startToken -> PROPERTY
+    22,  // 85: startToken -> STATICMETHOD
+    23,  // 86: startToken -> CLASSMETHOD
+    24,  // 87: startToken -> ABSTRACTMETHOD
+    2,  // 88: otherToken -> SELF
+    3,  // 89: otherToken -> INIT
+    4,  // 90: otherToken -> SUPER
+    5,  // 91: otherToken -> NONE
+    6,  // 92: otherToken -> ANY
+    7,  // 93: otherToken -> TRUE
+    8,  // 94: otherToken -> FALSE
+    9,  // 95: otherToken -> RETURN
+    10,  // 96: otherToken -> PASS
+    11,  // 97: otherToken -> IN
+    12,  // 98: otherToken -> IS
+    13,  // 99: otherToken -> IF
+    14,  // 100: otherToken -> ELIF
+    15,  // 101: otherToken -> ELSE
+    16,  // 102: otherToken -> FOR
+    17,  // 103: otherToken -> WHILE
+    18,  // 104: otherToken -> BREAK
+    19,  // 105: otherToken -> CONTINUE
+    20,  // 106: otherToken -> DECORATOR
+    25,  // 107: otherToken -> CLS
+    26,  // 108: otherToken -> COLON
+    28,  // 109: otherToken -> DOT
+    29,  // 110: otherToken -> OPEN_PARENTHESIS
+    31,  // 111: otherToken -> OPEN_BRACKET
+    32,  // 112: otherToken -> CLOSE_BRACKET
+    33,  // 113: otherToken -> OPEN_BRACE
+    34,  // 114: otherToken -> CLOSE_BRACE
+    35,  // 115: otherToken -> ASSIGN
+    36,  // 116: otherToken -> ARROW
+    39,  // 117: otherToken -> NEWLINE
+    40,  // 118: otherToken -> TYPE
+    41,  // 119: otherToken -> VARIABLE
+    42,  // 120: otherToken -> NUM
+    43,  // 121: otherToken -> STRING
+    44,  // 122: otherToken -> DOCSTRING
+    45,  // 123: otherToken -> LOGIC_OP
+    46,  // 124: otherToken -> PLUS
+    47,  // 125: otherToken -> MINUS
+    48,  // 126: otherToken -> MULT
+    49,  // 127: otherToken -> DIV
+    50,  // 128: otherToken -> MOD
+    51,  // 129: otherToken -> AND
+    52,  // 130: otherToken -> OR
+    53,  // 131: otherToken -> NOT
+    54,  // 132: otherToken -> FROM
+    55,  // 133: otherToken -> IMPORT
+};
+
+const uint16_t RHS_BEGIN[] = {
+       0,    3,    5,    7,    7,    8,    9,   17,   21,   21,   24,   24,   26,   26,   28,   28,
+      31,   34,   37,   40,   41,   47,   54,   61,   67,   68,   69,   73,   73,   76,   76,   79,
+      80,   82,   83,   85,   87,   87,   90,   91,   92,   95,   98,  101,  101,  102,  103,  106,
+     106,  107,  107,  109,  112,  112,  114,  114,  116,  116,  118,  118,  120,  120,  122,  124,
+     124,  126,  130,  130,  132,  132,  133,  134,  135,  136,  137,  138,  139,  140,  141,  142,
+     143,  144,  145,  146,  147,  148,  149,  150,  151,  152,  153,  154,  155,  156,  157,  158,
+     159,  160,  161,  162,  163,  164,  165,  166,  167,  168,  169,  170,  171,  172,  173,  174,
+     175,  176,  177,  178,  179,  180,  181,  182,  183,  184,  185,  186,  187,  188,  189,  190,
+     191,  192,  193,  194,  195,  196,  197,
+};
+
+const char* const NONTERMINAL_NAMES[] = {
+    "program",
+    "elements",
+    "moreElements",
+    "element",
+    "classDef",
+    "inheritance",
+    "moreParents",
+    "classBody",
+    "moreMethodDefs",
+    "methodDef",
+    "methodDefRaw",
+    "methodDefSelf",
+    "methodDefCls",
+    "methodDefTail",
+    "methodName",
+    "paramList",
+    "moreParams",
+    "parameter",
+    "paramName",
+    "starredName",
+    "typeHint",
+    "typeExpr",
+    "moreTypeName",
+    "typeNamePart",
+    "typeArguments",
+    "typeItems",
+    "typeList",
+    "moreTypes",
+    "defaultValue",
+    "returnType",
+    "preSkipStatements",
+    "postSkipStatements",
+    "anyTokens",
+    "methodBody",
+    "skipDefault",
+    "nonStartToken",
+    "bodyToken",
+    "defaultToken",
+    "startToken",
+    "otherToken",
+};
+
+}  // namespace ll1
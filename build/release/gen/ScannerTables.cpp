@@ -0,0 +1,1566 @@
+// Generated by scripts/gen_scanner.py from grammar/lexer.l, do not edit
+// 76 rules, 235 states, 61 byte classes
+#include "ScannerTables.h"
+
+namespace scanner {
+
+const int RULE_COUNT = 76;
+
+namespace {
+
+constexpr int STATE_COUNT = 235;
+constexpr int CLASS_COUNT = 61;
+constexpr int DEAD = 0;
+constexpr int START = 1;
+
+const uint8_t BYTE_CLASS[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   1,   2,   0,   0,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      1,   3,   4,   5,   0,   6,   0,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  18,  18,  18,  18,  18,  19,  19,  20,   0,  21,  22,  23,   0,
+     24,  25,  26,  25,  25,  27,  28,  29,  29,  29,  30,  29,  29,  29,  31,  32,
+     29,  29,  29,  29,  33,  29,  29,  29,  34,  29,  29,  35,  36,  37,   0,  38,
+      0,  39,  40,  41,  42,  43,  44,  29,  45,  46,  30,  47,  48,  49,  50,  51,
+     52,  29,  53,  54,  55,  56,  29,  57,  34,  58,  29,  59,   0,  60,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+const uint8_t TRANSITIONS[STATE_COUNT][CLASS_COUNT] = {
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   2,   3,  37,  30,   5,  35,   4,  42,  43,  33,  31,  41,  32,  14,  34,
+          7,   8,   8,   8,  40,  38,  36,  39,  25,  26,  26,  26,  27,  26,  26,  12,
+         26,  11,  26,  44,   0,  45,  20,   6,  24,  18,  19,  15,  16,  26,  13,  26,
+         28,  26,   9,  10,  23,  22,  21,  29,  26,  17,  26,  46,  47,
+    },
+    {
+          0,   2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+         48,  48,   0,  48,  48,  48,  48,  49,  48,  48,  48,  48,  48,  48,  48,  48,
+         48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+         48,  48,  48,  48,  50,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+         48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+    },
+    {
+          5,   5,   0,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,
+          5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,
+          5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,
+          5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  51,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  53,   0,
+          8,   8,   8,   8,   0,   0,   0,   0,   0,   0,  57,  55,   0,   0,  58,   0,
+         56,   0,  54,   0,   0,   0,  52,   0,  57,   0,   0,  55,   0,   0,   0,   0,
+          0,   0,   0,  56,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  53,   0,
+          8,   8,   8,   8,   0,   0,   0,   0,   0,   0,   0,  55,   0,   0,  58,   0,
+          0,   0,   0,   0,   0,   0,  52,   0,   0,   0,   0,  55,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  59,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  60,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  61,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  62,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  63,  26,  26,  26,
+         26,  64,  65,  26,  26,  26,  66,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         67,  67,  67,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         68,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         70,  26,  26,  71,  26,  69,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  72,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         73,  26,  26,  74,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  75,  26,  26,  76,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  77,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  78,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  79,  80,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  81,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  82,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  84,  26,  83,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  87,  86,  88,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  85,  86,  89,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  90,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  91,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  92,  26,  26,   0,   0,
+    },
+    {
+         95,  95,   0,  95,  94,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  93,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,  96,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,  97,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,  98,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,  99,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0, 100,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+         48,  48,   0,  48,  48,  48,  48, 101,  48,  48,  48,  48,  48,  48,  48,  48,
+         48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+         48,  48,  48,  48,  50,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+         48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0, 102,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+         48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+         48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+         48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+         48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,  48,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26, 103,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26, 104,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          8,   8,   8,   8,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         67,  67,  67,  67,   0,   0,   0,   0,   0,   0,   0,  55,   0,   0,  58,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  55,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        106, 106, 106, 106,   0,   0,   0,   0,   0, 106, 106, 106, 106,   0,   0,   0,
+          0,   0,   0,   0,   0,   0, 105, 106, 106, 106, 106, 106, 106,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 107,   0, 107,   0,   0,
+        108, 108, 108, 108,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        110, 110, 110,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0, 109,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        112, 112,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26, 113,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26, 114,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26, 115,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26, 116,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26, 117,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         67,  67,  67,  67,   0,   0,   0,   0,   0,   0,   0,  55,   0,   0,  58,   0,
+          0,   0,   0,   0,   0,   0, 118,   0,   0,   0,   0,  55,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26, 120,  26,
+         26,  26,  26,  26,  26,  26, 119,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26, 121,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26, 122,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26, 123,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26, 124,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26, 126,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26, 125,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26, 127,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26, 128,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26, 129,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26, 130,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+        132,  26,  26,  26,  26,  26,  26, 131,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26, 133,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26, 134,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26, 135,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26, 136,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26, 137,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26, 138,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86, 139,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86, 140,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+        141,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86, 142,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+        143,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26, 144,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26, 145,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+         95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+    },
+    {
+          0,   0,   0,   0, 146,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+         95,  95,   0,  95, 147,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  93,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+         95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,  95,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+        102, 102, 102, 102, 102, 102, 102, 149, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 148, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        106, 106, 106, 106,   0,   0,   0,   0,   0, 106, 106, 106, 106,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0, 106, 106, 106, 106, 106, 106,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        106, 106, 106, 106,   0,   0,   0,   0,   0, 106, 106, 106, 106,   0,   0,   0,
+          0,   0,   0,   0,   0,   0, 105, 106, 106, 106, 106, 106, 106,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        108, 108, 108, 108,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        108, 108, 108, 108,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  58,   0,
+          0,   0,   0,   0,   0,   0, 107,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        110, 110, 110,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        110, 110, 110,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0, 109,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        112, 112,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+        112, 112,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0, 111,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26, 150,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26, 151,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26, 152,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         67,  67,  67,  67,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26, 153,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26, 154,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26, 155,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26, 156,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+        157,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26, 158,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26, 159,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26, 160,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26, 161,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26, 162,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26, 163,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26, 164,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26, 165,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26, 166,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+        167,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86, 168,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86, 169,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86, 170,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86, 171,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26, 172,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26, 173,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+        174,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+        146, 146, 146, 146, 176, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 175, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    },
+    {
+        102, 102, 102, 102, 102, 102, 102, 178, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 177, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26, 179,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26, 180,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26, 181,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26, 182,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26, 183,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26, 184,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26, 185,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26, 186,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26, 187,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86, 188,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86, 189,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86, 190,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86, 191,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26, 192,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26, 193,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    },
+    {
+        146, 146, 146, 146, 195, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 194, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    },
+    {
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    },
+    {
+        102, 102, 102, 102, 102, 102, 102, 196, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 177, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+        102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102, 102,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26, 197,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26, 198,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26, 199,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26, 200,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86, 201,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86, 202,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86, 203,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86, 204,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    },
+    {
+        146, 146, 146, 146, 205, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 194, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+        146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26, 206,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0, 207,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86, 208,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86, 209,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86, 210,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86, 211,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26, 212,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0, 213,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86, 214,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86, 215,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86, 216,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86, 217,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         26,  26,  26,  26,   0,   0,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,   0,   0,   0,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,
+         26,  26,  26,  26,  26,  26,  26,  26,  26,  26,  26,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86, 218,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86, 219,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86, 220,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86, 221,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86, 222,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86, 223,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86, 224,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86, 225,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86, 226,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86, 227,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86, 228,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86, 229,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86, 230,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86, 231,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86, 232,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86, 233,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86, 234,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+         86,  86,  86,  86,   0,   0,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,   0,   0,   0,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,
+         86,  86,  86,  86,  86,  86,  86,  86,  86,  86,  86,   0,   0,
+    },
+};
+
+// Rule accepted in each state, -1 if none
+const int16_t ACCEPT[STATE_COUNT] = {
+     -1,  -1,   0,   1,  73,   2,  67,  63,  63,  67,  67,  67,  67,  67,  56,  67,
+     67,  67,  67,  67,  67,  67,  67,  67,  67,  66,  67,  67,  67,  67,  72,  41,
+     42,  43,  44,  45,  46,  -1,  49,  51,  54,  55,  57,  58,  59,  60,  61,  62,
+     73,  69,  73,  67,  -1,  64,  -1,  -1,  -1,  -1,  65,  67,   4,  67,  67,  10,
+     67,  23,  24,  64,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,  67,
+     67,  67,  67,  67,  67,  66,  66,  66,  66,  66,  67,  67,  67,  72,  68,  72,
+     53,  47,  48,  50,  52,  69,  75,   3,   9,  -1,  63,  -1,  64,  -1,  63,  -1,
+     63,   5,  67,  67,  67,  29,  -1,  67,  67,  67,  67,  13,  67,  19,  67,  67,
+     16,  67,  67,  35,  67,  31,  67,  67,  67,  67,  67,  66,  66,  66,  66,  67,
+     67,  67,  74,  68,  75,  75,   6,   8,  67,  12,  11,  27,  67,  67,  67,  67,
+     33,  67,  18,  67,  67,  22,  67,  36,  66,  66,  66,  66,  67,  32,  67,  74,
+     74,  -1,  75,  67,  30,  14,  15,  67,  67,  20,  67,  25,  66,  66,  66,  66,
+      7,  34,  -1,  74,  71,  28,  67,  67,  21,  66,  66,  66,  66,  70,  67,  67,
+     66,  66,  66,  66,  26,  17,  66,  66,  66,  66,  37,  66,  66,  66,  66,  66,
+     66,  66,  66,  66,  66,  39,  66,  66,  38,  66,  40,
+};
+
+}  // namespace
+
+const Rule RULES[] = {
+    {Action::Skip, -1, nullptr},  // lexer.l:28
+    {Action::Newline, static_cast<int>(Tag::NEWLINE), nullptr},  // lexer.l:29
+    {Action::Skip, -1, nullptr},  // lexer.l:30
+    {Action::Token, static_cast<int>(Tag::AND), "and"},  // lexer.l:32
+    {Action::Token, static_cast<int>(Tag::OR), "or"},  // lexer.l:33
+    {Action::Token, static_cast<int>(Tag::NOT), "not"},  // lexer.l:34
+    {Action::Token, static_cast<int>(Tag::TRUE), "True"},  // lexer.l:35
+    {Action::Token, static_cast<int>(Tag::FALSE), "False"},  // lexer.l:36
+    {Action::Token, static_cast<int>(Tag::NONE), "None"},  // lexer.l:37
+    {Action::Token, static_cast<int>(Tag::ANY), "any"},  // lexer.l:38
+    {Action::Token, static_cast<int>(Tag::IF), "if"},  // lexer.l:39
+    {Action::Token, static_cast<int>(Tag::ELIF), "elif"},  // lexer.l:40
+    {Action::Token, static_cast<int>(Tag::ELSE), "else"},  // lexer.l:41
+    {Action::Token, static_cast<int>(Tag::FOR), "for"},  // lexer.l:42
+    {Action::Token, static_cast<int>(Tag::WHILE), "while"},  // lexer.l:43
+    {Action::Token, static_cast<int>(Tag::CLASS), "class"},  // lexer.l:44
+    {Action::Token, static_cast<int>(Tag::DEF), "def"},  // lexer.l:45
+    {Action::Token, static_cast<int>(Tag::INIT), "__init__"},  // lexer.l:46
+    {Action::Token, static_cast<int>(Tag::SELF), "self"},  // lexer.l:47
+    {Action::Token, static_cast<int>(Tag::CLS), "cls"},  // lexer.l:48
+    {Action::Token, static_cast<int>(Tag::SUPER), "super"},  // lexer.l:49
+    {Action::Token, static_cast<int>(Tag::RETURN), "return"},  // lexer.l:50
+    {Action::Token, static_cast<int>(Tag::PASS), "pass"},  // lexer.l:51
+    {Action::Token, static_cast<int>(Tag::IN), "in"},  // lexer.l:52
+    {Action::Token, static_cast<int>(Tag::IS), "is"},  // lexer.l:53
+    {Action::Token, static_cast<int>(Tag::BREAK), "break"},  // lexer.l:54
+    {Action::Token, static_cast<int>(Tag::CONTINUE), "continue"},  // lexer.l:55
+    {Action::Token, static_cast<int>(Tag::FROM), "from"},  // lexer.l:56
+    {Action::Token, static_cast<int>(Tag::IMPORT), "import"},  // lexer.l:57
+    {Action::Token, static_cast<int>(Tag::TYPE), "int"},  // lexer.l:59
+    {Action::Token, static_cast<int>(Tag::TYPE), "float"},  // lexer.l:60
+    {Action::Token, static_cast<int>(Tag::TYPE), "str"},  // lexer.l:61
+    {Action::Token, static_cast<int>(Tag::TYPE), "list"},  // lexer.l:62
+    {Action::Token, static_cast<int>(Tag::TYPE), "dict"},  // lexer.l:63
+    {Action::Token, static_cast<int>(Tag::TYPE), "tuple"},  // lexer.l:64
+    {Action::Token, static_cast<int>(Tag::TYPE), "set"},  // lexer.l:65
+    {Action::Token, static_cast<int>(Tag::TYPE), "bool"},  // lexer.l:66
+    {Action::Token, static_cast<int>(Tag::PROPERTY), "@property"},  // lexer.l:68
+    {Action::Token, static_cast<int>(Tag::STATICMETHOD), "@staticmethod"},  // lexer.l:69
+    {Action::Token, static_cast<int>(Tag::CLASSMETHOD), "@classmethod"},  // lexer.l:70
+    {Action::Token, static_cast<int>(Tag::ABSTRACTMETHOD), "@abstractmethod"},  // lexer.l:71
+    {Action::Token, static_cast<int>(Tag::PLUS), "+"},  // lexer.l:73
+    {Action::Token, static_cast<int>(Tag::MINUS), "-"},  // lexer.l:74
+    {Action::Token, static_cast<int>(Tag::MULT), "*"},  // lexer.l:75
+    {Action::Token, static_cast<int>(Tag::DIV), "/"},  // lexer.l:76
+    {Action::Token, static_cast<int>(Tag::MOD), "%"},  // lexer.l:77
+    {Action::Token, static_cast<int>(Tag::ASSIGN), "="},  // lexer.l:78
+    {Action::Token, static_cast<int>(Tag::LOGIC_OP), "=="},  // lexer.l:79
+    {Action::Token, static_cast<int>(Tag::LOGIC_OP), "!="},  // lexer.l:80
+    {Action::Token, static_cast<int>(Tag::LOGIC_OP), "<"},  // lexer.l:81
+    {Action::Token, static_cast<int>(Tag::LOGIC_OP), "<="},  // lexer.l:82
+    {Action::Token, static_cast<int>(Tag::LOGIC_OP), ">"},  // lexer.l:83
+    {Action::Token, static_cast<int>(Tag::LOGIC_OP), ">="},  // lexer.l:84
+    {Action::Token, static_cast<int>(Tag::ARROW), "->"},  // lexer.l:85
+    {Action::Token, static_cast<int>(Tag::COLON), ":"},  // lexer.l:87
+    {Action::Token, static_cast<int>(Tag::COMMA), ","},  // lexer.l:88
+    {Action::Token, static_cast<int>(Tag::DOT), "."},  // lexer.l:89
+    {Action::Token, static_cast<int>(Tag::OPEN_PARENTHESIS), "("},  // lexer.l:90
+    {Action::Token, static_cast<int>(Tag::CLOSE_PARENTHESIS), ")"},  // lexer.l:91
+    {Action::Token, static_cast<int>(Tag::OPEN_BRACKET), "["},  // lexer.l:92
+    {Action::Token, static_cast<int>(Tag::CLOSE_BRACKET), "]"},  // lexer.l:93
+    {Action::Token, static_cast<int>(Tag::OPEN_BRACE), "{"},  // lexer.l:94
+    {Action::Token, static_cast<int>(Tag::CLOSE_BRACE), "}"},  // lexer.l:95
+    {Action::Token, static_cast<int>(Tag::NUM), nullptr},  // lexer.l:97
+    {Action::Token, static_cast<int>(Tag::NUM), nullptr},  // lexer.l:98
+    {Action::Token, static_cast<int>(Tag::NUM), nullptr},  // lexer.l:99
+    {Action::Token, static_cast<int>(Tag::DECORATOR), nullptr},  // lexer.l:101
+    {Action::Token, static_cast<int>(Tag::VARIABLE), nullptr},  // lexer.l:102
+    {Action::Token, static_cast<int>(Tag::STRING), nullptr},  // lexer.l:104
+    {Action::Token, static_cast<int>(Tag::STRING), nullptr},  // lexer.l:105
+    {Action::Token, static_cast<int>(Tag::DOCSTRING), nullptr},  // lexer.l:106
+    {Action::Token, static_cast<int>(Tag::DOCSTRING), nullptr},  // lexer.l:107
+    {Action::Error, -1, "Unterminated string"},  // lexer.l:109
+    {Action::Error, -1, "Unterminated string"},  // lexer.l:110
+    {Action::Error, -1, "Unterminated docstring"},  // lexer.l:111
+    {Action::Error, -1, "Unterminated docstring"},  // lexer.l:112
+};
+
+int match(const char* begin, const char* end, const char*& match_end) {
+    int state = START;
+    int rule = -1;
+    match_end = begin;
+    for (const char* p = begin; p < end; ) {
+        state = TRANSITIONS[state][BYTE_CLASS[static_cast<unsigned char>(*p)]];
+        if (state == DEAD) {
+            break;
+        }
+        p++;
+        if (ACCEPT[state] >= 0) {
+            rule = ACCEPT[state];
+            match_end = p;
+        }
+    }
+    return rule;
+}
+
+}  // namespace scanner
@@ -1,22 +1,43 @@
-%{
-#include <stdio.h>
+/* LALR(1) grammar of the language RecursiveDescendant accepts, compiled by
+   bison into the LalrParser backend. Statements the parser does not look
+   into (code around the definitions, method bodies, default values) are
+   spelled out as token classes, so both parsers accept and reject exactly
+   the same streams. Lists are left recursive to keep bison's stack flat on
+   long bodies. */
+
+%code requires {
+class LalrParser;
+}
+
+%code {
+#include "LalrParser.h"
 #include "Token.h"
-#include "Lexer.h"
-
-// Variables para tracking OOP
-bool hasClass = false;
-bool hasInheritance = false;
-bool hasInit = false;
-bool hasSelf = false;
-bool hasSuper = false;
-bool hasDecorator = false;
-%}
-
-// Tokens
-%token CLASS DEF SELF CLS TYPE VARIABLE INIT MULT
-%token PROPERTY STATICMETHOD CLASSMETHOD ABSTRACTMETHOD
-%token COLON COMMA OPEN_PARENTHESIS CLOSE_PARENTHESIS
-%token ASSIGN ARROW NEWLINE INDENT DEDENT
+
+static int lalrlex(LALRSTYPE* value, LalrParser* parser);
+static void lalrerror(LalrParser* parser, const char* message);
+}
+
+%define api.prefix {lalr}
+%define api.token.prefix {TOK_}
+%define api.pure full
+%define parse.error verbose
+%param {LalrParser* parser}
+
+/* Keywords */
+%token CLASS DEF SELF INIT SUPER NONE ANY TRUE FALSE RETURN PASS IN IS
+%token IF ELIF ELSE FOR WHILE BREAK CONTINUE
+/* OOP specific */
+%token DECORATOR PROPERTY STATICMETHOD CLASSMETHOD ABSTRACTMETHOD CLS
+/* Punctuation */
+%token COLON COMMA DOT OPEN_PARENTHESIS CLOSE_PARENTHESIS
+%token OPEN_BRACKET CLOSE_BRACKET OPEN_BRACE CLOSE_BRACE ASSIGN ARROW
+/* Indentation */
+%token INDENT DEDENT NEWLINE
+/* Types */
+%token TYPE VARIABLE NUM STRING DOCSTRING
+/* Operators */
+%token LOGIC_OP PLUS MINUS MULT DIV MOD AND OR NOT
+%token FROM IMPORT
 
 %%
 
@@ -26,55 +47,39 @@ program
     ;
 
 elements
-    : element moreElements
-    ;
-
-moreElements
-    : element moreElements
-    | %empty
+    : element
+    | elements element
     ;
 
 element
-    : classDefs
-    | methodDefs
+    : classDef
+    | methodDef
     ;
 
 // Class Definitions
-classDefs
-    : classDef moreClassDefs
-    ;
-
-moreClassDefs
-    : classDef moreClassDefs
-    | %empty
-    ;
-
 classDef
-    : CLASS VARIABLE inheritance COLON classSuite
+    : CLASS VARIABLE inheritance COLON NEWLINE INDENT classBody DEDENT
     ;
 
 inheritance
-    : OPEN_PARENTHESIS parentList CLOSE_PARENTHESIS
-    | %empty
+    : %empty
+    | OPEN_PARENTHESIS parentList CLOSE_PARENTHESIS
     ;
 
 parentList
-    : VARIABLE moreParents
+    : VARIABLE
+    | parentList COMMA VARIABLE
     ;
 
-moreParents
-    : COMMA VARIABLE moreParents
-    | %empty
+classBody
+    : %empty
+    | methodDefs
     ;
 
 // Method Definitions
 methodDefs
-    : methodDef moreMethodDefs
-    ;
-
-moreMethodDefs
-    : methodDef moreMethodDefs
-    | %empty
+    : methodDef
+    | methodDefs methodDef
     ;
 
 methodDef
@@ -98,7 +103,7 @@ methodDefCls
     ;
 
 methodDefTail
-    : returnType COLON methodSuite
+    : returnType COLON NEWLINE INDENT methodBody DEDENT
     ;
 
 methodName
@@ -106,14 +111,15 @@ methodName
     | VARIABLE
     ;
 
+// The first parameter of a static method cannot be starred
 paramList
-    : parameter moreParams
-    | %empty
+    : %empty
+    | VARIABLE typeHint defaultValue moreParams
     ;
 
 moreParams
-    : COMMA parameter moreParams
-    | %empty
+    : %empty
+    | moreParams COMMA parameter
     ;
 
 parameter
@@ -127,58 +133,136 @@ paramName
     ;
 
 typeHint
-    : COLON TYPE
-    | %empty
+    : %empty
+    | COLON typeExpr
     ;
 
-defaultValue
-    : ASSIGN skipDefault
-    | %empty
+// Type hints: a dotted name with [arguments], None, a forward reference in
+// a string, ... and [lists] of types (the parameters of Callable[[int], str])
+typeExpr
+    : typeName
+    | typeName OPEN_BRACKET typeList CLOSE_BRACKET
+    | NONE
+    | STRING
+    | DOT DOT DOT
+    | OPEN_BRACKET CLOSE_BRACKET
+    | OPEN_BRACKET typeList CLOSE_BRACKET
     ;
 
-returnType
-    : ARROW TYPE
-    | %empty
+typeName
+    : typeNamePart
+    | typeName DOT typeNamePart
     ;
 
-// Suite and Statements
-classSuite
-    : NEWLINE INDENT classBody DEDENT
+typeNamePart
+    : TYPE
+    | VARIABLE
     ;
 
-methodSuite
-    : NEWLINE INDENT methodBody DEDENT
+typeList
+    : typeExpr
+    | typeList COMMA typeExpr
     ;
 
-methodBody
-    : skipStatement methodBody
-    | %empty
+defaultValue
+    : %empty
+    | ASSIGN skipDefault
     ;
 
-classBody
-    : methodDefs methodBody
-    | %empty
+returnType
+    : %empty
+    | ARROW typeExpr
     ;
 
-// Skip statements (no parsing, just token consumption)
+// Skipped code: anything before the first definition, anything after the
+// last one, balanced INDENT/DEDENT blocks in a method body and any tokens
+// up to the comma or parenthesis that ends a default value
 preSkipStatements
     : %empty
+    | preSkipStatements nonStartToken
     ;
 
-skipStatement
+postSkipStatements
     : %empty
+    | nonStartToken anyTokens
     ;
 
-skipDefault
+anyTokens
     : %empty
+    | anyTokens nonStartToken
+    | anyTokens startToken
     ;
 
-postSkipStatements
+methodBody
+    : %empty
+    | methodBody bodyToken
+    | methodBody INDENT methodBody DEDENT
+    ;
+
+skipDefault
     : %empty
+    | skipDefault defaultToken
+    ;
+
+// Token classes
+nonStartToken
+    : otherToken
+    | INDENT | DEDENT | COMMA | CLOSE_PARENTHESIS
+    ;
+
+bodyToken
+    : otherToken
+    | startToken | COMMA | CLOSE_PARENTHESIS
+    ;
+
+defaultToken
+    : otherToken
+    | startToken | INDENT | DEDENT
+    ;
+
+// Tokens that begin a definition
+startToken
+    : CLASS | DEF | PROPERTY | STATICMETHOD | CLASSMETHOD | ABSTRACTMETHOD
+    ;
+
+otherToken
+    : SELF | INIT | SUPER | NONE | ANY | TRUE | FALSE | RETURN | PASS | IN | IS
+    | IF | ELIF | ELSE | FOR | WHILE | BREAK | CONTINUE
+    | DECORATOR | CLS
+    | COLON | DOT | OPEN_PARENTHESIS | OPEN_BRACKET | CLOSE_BRACKET
+    | OPEN_BRACE | CLOSE_BRACE | ASSIGN | ARROW | NEWLINE
+    | TYPE | VARIABLE | NUM | STRING | DOCSTRING
+    | LOGIC_OP | PLUS | MINUS | MULT | DIV | MOD | AND | OR | NOT
+    | FROM | IMPORT
     ;
 
 %%
 
-void yyerror(const char *s) {
-    fprintf(stderr, "Syntax error: %s\n", s);
-}
\ No newline at end of file
+// Token kind of every Tag, in the order of the enum
+static const lalrtoken_kind_t TOKENS[] = {
+    TOK_CLASS, TOK_DEF, TOK_SELF, TOK_INIT, TOK_SUPER, TOK_NONE, TOK_ANY, TOK_TRUE, TOK_FALSE,
+    TOK_RETURN, TOK_PASS, TOK_IN, TOK_IS, TOK_IF, TOK_ELIF, TOK_ELSE, TOK_FOR, TOK_WHILE,
+    TOK_BREAK, TOK_CONTINUE,
+    TOK_DECORATOR, TOK_PROPERTY, TOK_STATICMETHOD, TOK_CLASSMETHOD, TOK_ABSTRACTMETHOD, TOK_CLS,
+    TOK_COLON, TOK_COMMA, TOK_DOT, TOK_OPEN_PARENTHESIS, TOK_CLOSE_PARENTHESIS,
+    TOK_OPEN_BRACKET, TOK_CLOSE_BRACKET, TOK_OPEN_BRACE, TOK_CLOSE_BRACE, TOK_ASSIGN, TOK_ARROW,
+    TOK_INDENT, TOK_DEDENT, TOK_NEWLINE,
+    TOK_TYPE, TOK_VARIABLE, TOK_NUM, TOK_STRING, TOK_DOCSTRING,
+    TOK_LOGIC_OP, TOK_PLUS, TOK_MINUS, TOK_MULT, TOK_DIV, TOK_MOD, TOK_AND, TOK_OR, TOK_NOT,
+    TOK_FROM, TOK_IMPORT
+};
+static_assert(sizeof(TOKENS) / sizeof(TOKENS[0]) == TAG_COUNT, "TOKENS must list every Tag");
+
+static int lalrlex(LALRSTYPE* value, LalrParser* parser) {
+    *value = LALRSTYPE();  // Tokens carry no semantic value
+    Token* token = parser->nextToken();
+    return token ? TOKENS[token->tag] : TOK_YYEOF;
+}
+
+static void lalrerror(LalrParser* parser, const char* message) {
+    parser->syntaxError(message);
+}
+
+int LalrParser::run() {
+    return lalrparse(this);
+}
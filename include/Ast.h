@@ -0,0 +1,105 @@
+#ifndef AST_H
+#define AST_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class TokenStream;
+
+// Syntax tree of method bodies, built by RecursiveDescendant when
+// setParseBodies(true) is on. Nodes live in one flat array (Outline::ast)
+// and refer to each other by index: a node's children are its first child
+// and that child's chain of next siblings, in source order.
+enum class AstKind : uint8_t {
+    // Statements
+    Body,           // Statements of a block
+    If,             // test, body, then an If (elif) or a Body (else) if any
+    For,            // target, iterable, body, else body if any
+    While,          // test, body, else body if any
+    Try,            // body, handlers, else body (Empty if only finally has one), finally body if any
+    Handler,        // except clause: type and name if any, then its body
+    With,           // items, then the body
+    WithItem,       // context expression, target if any
+    Return,         // value if any
+    Pass,
+    Break,
+    Continue,
+    Raise,          // exception and cause if any
+    Assert,         // test, message if any
+    Delete,         // targets
+    Global,         // names
+    Nonlocal,       // names
+    Import,         // aliases
+    ImportFrom,     // module if any (leading dots are not kept), then aliases, none for *
+    Alias,          // dotted name, name after "as" if any
+    Assign,         // targets, then the value
+    AugAssign,      // target, value
+    AnnAssign,      // target, annotation, value if any
+    Expression,     // Expression statement
+    FunctionDef,    // Nested def: decorators, Parameters, return annotation or Empty, body; token is the name
+    ClassDef,       // Nested class: decorators, bases and keywords, body; token is the name
+    Parameter,      // annotation or Empty, default if any; token is the name (op Star/DoubleStar for *a/**k)
+
+    // Expressions
+    Name,
+    Number,
+    String,         // One or more adjacent literals, token is the first one
+    Constant,       // True, False or None
+    Ellipsis,
+    Unary,
+    Binary,
+    BoolOp,
+    Compare,        // Chains nest to the left: a < b < c is (a < b) < c
+    IfExp,          // body, test, orelse
+    Lambda,         // Parameters, then the body
+    Await,
+    Yield,          // value if any
+    Call,           // function, then arguments
+    Keyword,        // name=value argument: value, token is the name
+    Starred,        // *value or **value
+    Attribute,      // value, token is the attribute name
+    Subscript,      // value, index
+    Slice,          // lower, upper and step, Empty where left out
+    Tuple,
+    List,
+    Dict,           // key/value pairs; a **value has an Empty key
+    Set,
+    ListComp,       // element, then ComprehensionFor clauses
+    SetComp,
+    DictComp,       // key, value, then ComprehensionFor clauses
+    Generator,
+    ComprehensionFor, // target, iterable, conditions
+    Empty           // Missing optional child where position matters
+};
+
+// Operator of Unary, Binary, BoolOp, Compare, AugAssign, Starred and Yield
+// nodes
+enum class AstOp : uint8_t {
+    None,
+    Add, Sub, Mult, Div, FloorDiv, Mod, Pow, LShift, RShift,  // Binary, AugAssign
+    UAdd, USub, Not,                                          // Unary
+    And, Or,                                                  // BoolOp
+    Eq, NotEq, Lt, LtE, Gt, GtE, In, NotIn, Is, IsNot,        // Compare
+    Star, DoubleStar,                                         // Starred
+    From                                                      // yield from
+};
+
+struct AstNode {
+    AstKind kind;
+    AstOp op = AstOp::None;
+    uint32_t token = 0;         // Stream position of the node's main token
+    int32_t first_child = -1;   // Indices into the node array, -1 if none
+    int32_t next_sibling = -1;
+};
+
+// Names of a kind and of an operator, as in dumpAst
+const char* astKindName(AstKind kind);
+const char* astOpName(AstOp op);
+
+// Writes the subtree at root as an S-expression, e.g.
+// (Return (Binary + (Name x) (Number 1))). Node texts are read from the
+// stream the tree was parsed from.
+std::string dumpAst(const std::vector<AstNode>& nodes, int32_t root, const TokenStream& stream);
+
+#endif // AST_H
@@ -0,0 +1,52 @@
+#ifndef BATCH_RESULTS_H
+#define BATCH_RESULTS_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Verdicts of a batch run (main --verdicts) split across processes or
+// machines with --shard=i/N, each writing a results file, and combined
+// with --merge.
+//
+// A results file is JSON Lines: a header
+//   {"shard":i,"shards":N,"inputs":count}
+// then one record per input, sorted by name (bytewise):
+//   {"name":"a.py","accepted":false,"ns":1234,"error":"..."}
+// Inputs go to shards by a stable hash of their name, so processes given
+// the same inputs under the same names agree on the split wherever they
+// run, and no shard needs to know what the others got.
+struct Shard {
+    uint32_t index = 0;
+    uint32_t count = 1;
+
+    // "i/N" with 0 <= i < N; throws std::runtime_error otherwise
+    static Shard parse(const std::string& text);
+    bool owns(std::string_view name) const;
+};
+
+struct BatchResult {
+    std::string name;
+    bool accepted = false;
+    int64_t ns = 0;      // Best time of the runs
+    std::string error;   // Empty if accepted
+};
+
+// Writes the results of one shard, sorting them by name
+void writeResults(const std::string& path, const Shard& shard, std::vector<BatchResult> results);
+
+struct MergeSummary {
+    uint32_t shards = 0;
+    size_t inputs = 0;
+    size_t accepted = 0;
+};
+
+// Merges the results files of shards 0 to N-1 of one run into a results
+// file of shard 0/1, with a k-way merge that keeps one record per file in
+// memory. Throws std::runtime_error if a shard is missing or repeated, the
+// files disagree on N, a file is truncated or unsorted, or an input is in
+// the wrong shard (named differently on another machine, say).
+MergeSummary mergeResults(const std::vector<std::string>& paths, const std::string& output);
+
+#endif // BATCH_RESULTS_H
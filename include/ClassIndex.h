@@ -0,0 +1,191 @@
+#ifndef CLASS_INDEX_H
+#define CLASS_INDEX_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "FileLoader.h"
+#include "MappedFile.h"
+#include "Outline.h"
+
+// On-disk layout of a class index. Every section is an array of 32-bit
+// fields, so the file can be used in place after mapping it:
+//
+//   ClassIndexHeader
+//   IndexedClass[class_count]   sorted by name, then by file
+//   IndexString[file_count]     defining files
+//   IndexString[parent_count]   parent names, as written in the source
+//   IndexedMethod[method_count] grouped by class, in class order
+//   uint32_t[child_count]       direct subclasses, CSR by IndexedClass
+//   uint32_t[method_count]      methods by name, then id
+//   uint32_t[method_count]      methods by first parameter, then id
+//   uint32_t[method_count]      methods by return type, then id
+//   uint32_t[decorated_count]   methods by decorator, runs given by the header
+//   IndexedParent[parent_count] parent names by name, then class
+//   char[string_bytes]          string pool
+struct IndexString {
+    uint32_t offset;  // In the string pool
+    uint32_t length;
+};
+
+struct IndexedClass {
+    IndexString name;
+    uint32_t file;
+    uint32_t first_parent;
+    uint32_t parent_count;
+    uint32_t first_method;
+    uint32_t method_count;
+    uint32_t first_child;
+    uint32_t child_count;
+};
+
+struct IndexedMethod {
+    IndexString name;
+    uint32_t decorators;  // Decorator flags
+    uint32_t param_count; // Including self/cls
+    uint32_t cls;         // Class defining it
+    IndexString first_param;  // self, cls or whatever comes first, empty if none
+    IndexString return_type;  // Normalized hint (TypeNode::text), empty if none
+};
+
+struct IndexedParent {
+    IndexString name;
+    uint32_t cls;         // Class that has it among its parents
+};
+
+struct ClassIndexHeader {
+    char magic[4];  // "OOPI"
+    uint32_t version;
+    uint32_t class_count;
+    uint32_t file_count;
+    uint32_t parent_count;
+    uint32_t method_count;
+    uint32_t child_count;
+    uint32_t string_bytes;
+    // Methods with the decorator of bit b are decorated[decorated_first[b],
+    // decorated_first[b + 1])
+    uint32_t decorated_first[5];
+};
+
+// Collects the outlines of many files and writes them as a class index
+class ClassIndexBuilder {
+public:
+    void add(const std::string& file, const Outline& outline);
+
+    // Parses the files with the given number of threads (0 = one per
+    // hardware thread) and adds their outlines in the order given. Files
+    // that fail to parse still contribute the classes recognized before the
+    // error, those that fail to read or lex contribute none; returns how
+    // many failed. Files are read ahead of the parsers by a FileLoader
+    // using io.
+    size_t addFiles(const std::vector<std::string>& files, unsigned threads = 0,
+                    FileLoader::Backend io = FileLoader::Backend::Auto);
+
+    void write(const std::string& path) const;
+
+    size_t classCount() const { return this->classes.size(); }
+
+private:
+    struct Entry {
+        uint32_t file;
+        ClassInfo info;
+    };
+    std::vector<std::string> files;
+    std::vector<Entry> classes;
+    // The hints of every class added, one node per distinct type
+    TypeTable types;
+};
+
+// A class index mapped from disk. Lookups by name are binary searches and
+// no query reads more than the classes it visits.
+class ClassIndex {
+public:
+    // Checks every offset and id of the file once, so that queries can
+    // trust them; throws std::runtime_error if one is out of bounds
+    explicit ClassIndex(const std::string& path);
+
+    size_t classCount() const { return this->header->class_count; }
+
+    // Classes named name (one per defining file) as the range [first, second)
+    std::pair<uint32_t, uint32_t> find(std::string_view name) const;
+
+    std::string_view name(uint32_t cls) const;
+    std::string_view file(uint32_t cls) const;
+    std::vector<std::string_view> parents(uint32_t cls) const;
+    std::vector<std::string_view> methods(uint32_t cls) const;
+    const IndexedMethod* findMethod(uint32_t cls, std::string_view method) const;
+
+    // Direct subclasses of cls
+    std::vector<uint32_t> children(uint32_t cls) const;
+
+    // Every class that inherits, directly or not, from a class named name,
+    // sorted by name
+    std::vector<uint32_t> subclasses(std::string_view name) const;
+
+    // The class a parent name of cls refers to: the one defined in the same
+    // file if any, else the first one in the index. -1 if it is not indexed.
+    int64_t resolve(uint32_t cls, std::string_view parent) const;
+
+    struct Unimplemented {
+        uint32_t cls;             // Class without subclasses that inherits it
+        std::string_view method;
+        uint32_t declared_in;     // Class with the @abstractmethod
+    };
+
+    // Inherited @abstractmethods a leaf class (one without subclasses) sees:
+    // no class before the declaring one in the leaf's method resolution
+    // order, Python's C3 linearization, defines the name
+    std::vector<Unimplemented> unimplementedAbstract() const;
+
+    // Methods are numbered across the index, grouped by class in class order
+    size_t methodCount() const { return this->header->method_count; }
+    const IndexedMethod& method(uint32_t id) const { return this->method_records[id]; }
+    std::string_view methodName(uint32_t id) const { return str(this->method_records[id].name); }
+    std::string_view firstParam(uint32_t id) const { return str(this->method_records[id].first_param); }
+    std::string_view returnType(uint32_t id) const { return str(this->method_records[id].return_type); }
+
+    // Ids in increasing order, straight from a secondary index
+    struct Ids {
+        const uint32_t* first;
+        const uint32_t* last;
+        const uint32_t* begin() const { return this->first; }
+        const uint32_t* end() const { return this->last; }
+        size_t size() const { return static_cast<size_t>(this->last - this->first); }
+    };
+
+    // Lookups in the secondary indexes, binary searches that read nothing
+    // but the ids they return and the keys they compare
+    Ids methodsNamed(std::string_view name) const;
+    Ids methodsWithFirstParam(std::string_view name) const;
+    Ids methodsReturning(std::string_view type) const;
+    Ids methodsDecorated(Decorator decorator) const;
+    // Classes that list name among their direct parents, in increasing order
+    std::vector<uint32_t> classesWithParent(std::string_view name) const;
+
+private:
+    MappedFile mapping;
+    const ClassIndexHeader* header;
+    const IndexedClass* classes;
+    const IndexString* files;
+    const IndexString* parent_names;
+    const IndexedMethod* method_records;
+    const uint32_t* child_ids;
+    const uint32_t* by_name;
+    const uint32_t* by_first_param;
+    const uint32_t* by_return_type;
+    const uint32_t* decorated;
+    const IndexedParent* by_parent;
+    const char* strings;
+
+    bool valid() const;
+    // The ids of sorted whose key (a string of their IndexedMethod) is value
+    Ids methodsBy(const uint32_t* sorted, IndexString IndexedMethod::*key, std::string_view value) const;
+
+    std::string_view str(const IndexString& s) const {
+        return std::string_view(this->strings + s.offset, s.length);
+    }
+};
+
+#endif // CLASS_INDEX_H
@@ -0,0 +1,57 @@
+#ifndef DATASET_H
+#define DATASET_H
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Decodes the string value stored under key in a one-line JSON object
+// (a JSONL record) into out. Returns false if the record has no such
+// string field. out is overwritten, so reusing it avoids allocations.
+bool jsonStringField(std::string_view record, std::string_view key, std::string& out);
+// The same for an integer and a boolean field
+bool jsonIntField(std::string_view record, std::string_view key, int64_t& out);
+bool jsonBoolField(std::string_view record, std::string_view key, bool& out);
+
+// Reads the snippets of a JSONL dataset in the format of
+// scripts/dataset.jsonl, one record per line. A gzip file (.jsonl.gz, told
+// by its magic bytes, possibly of several members) is decompressed with
+// zlib as it is read. Records are split and decoded in place in one
+// window of the text, which only grows to hold the longest record, so
+// memory stays bounded on datasets of any size.
+class DatasetReader {
+public:
+    explicit DatasetReader(const std::string& filename, std::string field = "correct_code");
+    ~DatasetReader();
+
+    DatasetReader(const DatasetReader&) = delete;
+    DatasetReader& operator=(const DatasetReader&) = delete;
+
+    // Stores the next snippet in code. Records without the field are
+    // skipped; returns false at the end of the file.
+    bool next(std::string& code);
+    size_t lineNumber() const { return line_number; }
+
+private:
+    struct Inflater;
+
+    std::ifstream file;
+    std::unique_ptr<Inflater> inflater;  // Null for plain text
+    std::string filename;
+    std::string field;
+    std::vector<char> window;  // Text read; [begin, end) is not consumed yet
+    size_t begin = 0;
+    size_t end = 0;
+    size_t scanned = 0;        // [begin, scanned) has no newline
+    bool at_end = false;
+    size_t line_number = 0;
+
+    // Reads more text after end; false at the end of the input
+    bool fill();
+    size_t read(char* out, size_t size);
+};
+
+#endif // DATASET_H
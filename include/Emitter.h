@@ -0,0 +1,33 @@
+#ifndef EMITTER_H
+#define EMITTER_H
+
+#include <string>
+#include <string_view>
+#include "Outline.h"
+#include "TokenStream.h"
+
+// Output formats of main --emit. Every emit function appends to out, so a
+// single buffer can be reused for many files and written in one call.
+enum class EmitMode {
+    Tokens,   // One token per line: tag name, then its text
+    Outline,  // Classes and method signatures, indented like Python
+    Json,     // The outline as one JSON object per file (JSONL)
+    Binary,   // The token stream in the TokenSerializer format
+    Ast       // Syntax tree of every method body, one method per line
+};
+
+// Parses "tokens", "outline", "json", "bin" or "ast"
+bool parseEmitMode(std::string_view name, EmitMode& mode);
+
+// Appends s as a quoted JSON string
+void appendJsonString(std::string& out, std::string_view s);
+
+void emitTokens(const TokenStream& stream, std::string& out);
+void emitOutline(const Outline& outline, std::string& out);
+// error is the parse error of the file, empty if it parsed
+void emitJson(std::string_view file, const Outline& outline, std::string_view error, std::string& out);
+// Class.method or function name, a space and dumpAst of its body. The
+// outline must have been parsed from stream with bodies on.
+void emitAst(const Outline& outline, const TokenStream& stream, std::string& out);
+
+#endif // EMITTER_H
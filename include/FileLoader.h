@@ -0,0 +1,80 @@
+#ifndef FILE_LOADER_H
+#define FILE_LOADER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Reads many files ahead of the threads that lex them. On Linux the
+// open/read/close of up to depth files are batched through one io_uring;
+// where io_uring is missing or not allowed, a pool of threads reads them
+// with pread. Either way at most depth files are in flight or loaded and
+// not yet taken, so memory stays bounded on any number of files.
+//
+// Files come out of next() in the order they finish loading, each in its
+// own buffer that a lexer can scan without a copy (Lexer::resetBuffer).
+class FileLoader {
+public:
+    enum class Backend {
+        Auto,       // io_uring if the kernel allows it, else Threads
+        IoUring,
+        Threads
+    };
+
+    struct File {
+        size_t index = 0;   // In the paths given
+        std::shared_ptr<std::string> contents;
+        std::string error;  // Empty if the file was read
+    };
+
+    // Starts loading at once. threads only sizes the pread pool.
+    explicit FileLoader(std::vector<std::string> paths, Backend backend = Backend::Auto, unsigned depth = 64,
+                        unsigned threads = 4);
+    ~FileLoader();
+
+    FileLoader(const FileLoader&) = delete;
+    FileLoader& operator=(const FileLoader&) = delete;
+
+    // Waits for a file not taken yet; false once every file was taken.
+    // Several threads can take files at the same time.
+    bool next(File& file);
+
+    // The backend in use, never Auto
+    Backend backend() const { return this->used; }
+
+    // Whether this kernel lets the process use io_uring for file loading
+    static bool ioUringAvailable();
+
+private:
+    std::vector<std::string> paths;
+    Backend used = Backend::Threads;
+    size_t depth;
+
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<File> loaded;
+    size_t started = 0;     // Files handed to the backend
+    size_t active = 0;      // Started and not loaded yet
+    size_t taken = 0;
+    bool stopping = false;
+    std::vector<std::thread> workers;
+
+    struct Ring;
+    std::unique_ptr<Ring> ring;
+
+    // Index of the next file to start. With wait, blocks until there is
+    // room for it; false once every file started, without wait also when
+    // there is no room.
+    bool claim(bool wait, size_t& index);
+    void finish(File file);
+
+    void readWithThreads();
+    void readWithRing();
+};
+
+#endif // FILE_LOADER_H
@@ -0,0 +1,68 @@
+#ifndef INDENTATION_H
+#define INDENTATION_H
+
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+// Moves i past the string literal starting at source[i] (a quote) with the
+// same rules as Lexer::handleStrings, adding the newlines it spans to line.
+// An unterminated literal stops at the end of its line (or of the source).
+size_t skipStringLiteral(std::string_view source, size_t i, int& line);
+
+// Calls visit(offset, line) for the first character of every line that
+// does not start inside a string literal, lines numbered from 1. Comments
+// and string literals are skipped like the lexer skips them.
+template <typename Visit>
+void forEachLineStart(std::string_view source, Visit&& visit) {
+    size_t n = source.size();
+    size_t i = 0;
+    int line = 1;
+    visit(i, line);
+    while (i < n) {
+        char c = source[i];
+        if (c == '\n') {
+            i++;
+            line++;
+            visit(i, line);
+        } else if (c == '#') {
+            while (i < n && source[i] != '\n') {
+                i++;
+            }
+        } else if (c == '"' || c == '\'') {
+            i = skipStringLiteral(source, i, line);
+        } else {
+            i++;
+        }
+    }
+}
+
+// Indentation of one source line
+struct LineIndent {
+    enum Status : uint8_t {
+        Blank,         // Empty, whitespace or comment only: no indentation tokens
+        Ok,
+        BadDedent,     // Dedents to a width that no enclosing block has
+        Inconsistent   // Tabs and spaces mixed so the width depends on the tab size
+    };
+
+    Status status = Blank;
+    int width = 0;  // Columns, tabs expanded to the next multiple of the tab width
+    int depth = 0;  // Indentation levels open on this line
+};
+
+// Python's default tab size
+constexpr int DEFAULT_TAB_WIDTH = 8;
+
+// Measures every line of source in one sweep, lines[i] being line i + 1.
+// The depth of each line comes from the stack of open widths, so the
+// lexer only has to compare the depths of consecutive lines to emit
+// INDENT and DEDENT tokens. With check_tabs, a line whose indentation
+// compares differently with tabs of tab_width columns and tabs of one
+// column is Inconsistent, like Python's TabError. Measuring stops at the
+// first error (the lexer throws there); later lines stay Blank.
+void measureIndentation(std::string_view source, int tab_width, bool check_tabs,
+                        std::pmr::vector<LineIndent>& lines);
+
+#endif // INDENTATION_H
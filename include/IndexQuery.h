@@ -0,0 +1,42 @@
+#ifndef INDEX_QUERY_H
+#define INDEX_QUERY_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "ClassIndex.h"
+
+// A structural query over a class index: terms separated by commas that
+// all have to hold.
+//
+//   method=NAME      methods named NAME
+//   decorator=D      methods with @D (property, staticmethod, classmethod, abstractmethod)
+//   first=NAME       methods whose first parameter is NAME (self, cls...)
+//   returns=TYPE     methods whose return hint is TYPE, compared normalized
+//                    (Union[str, None] finds -> Optional[str])
+//   class=NAME       classes named NAME, or the methods of those classes
+//   parent=NAME      classes with NAME among their direct parents, or the
+//                    methods of those classes
+//
+// A query with a method term finds methods, else it finds classes, e.g.
+// "first=cls,method=create" or "decorator=staticmethod,returns=str".
+// Every term is a lookup in one of the index's secondary indexes; the
+// smallest result is then filtered by binary searches in the others.
+class IndexQuery {
+public:
+    // Throws std::runtime_error on an unknown key or a malformed type
+    static IndexQuery parse(const std::string& text);
+
+    bool findsMethods() const;
+    // Ids of the matching methods or classes, in increasing order
+    std::vector<uint32_t> run(const ClassIndex& index) const;
+
+private:
+    enum class Key { Method, Decorator, First, Returns, Class, Parent };
+    std::vector<std::pair<Key, std::string>> terms;
+
+    std::vector<uint32_t> classes(const ClassIndex& index, bool& constrained) const;
+};
+
+#endif // INDEX_QUERY_H
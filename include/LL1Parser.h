@@ -0,0 +1,21 @@
+#ifndef LL1_PARSER_H
+#define LL1_PARSER_H
+
+#include "Parser.h"
+#include <cstdint>
+#include <vector>
+
+// Table-driven LL(1) recognizer: a symbol stack and the predict table
+// generated from grammar/pooLL1.y. Accepts the same token streams as
+// RecursiveDescendant but builds no outline, it is there to compare
+// parsing engines (see main --compare-parsers).
+class LL1Parser : public Parser {
+public:
+    LL1Parser(TokenStream* stream);
+    void parse() override;
+
+private:
+    std::vector<int16_t> symbols;  // Reused between parses
+};
+
+#endif // LL1_PARSER_H
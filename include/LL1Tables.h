@@ -0,0 +1,29 @@
+#ifndef LL1_TABLES_H
+#define LL1_TABLES_H
+
+#include <cstdint>
+#include "Token.h"
+
+// Predict table of the LL1Parser, generated at build time from
+// grammar/pooLL1.y by scripts/gen_ll1.py.
+namespace ll1 {
+
+// Grammar symbols: terminals are tags, END stands for the end of the
+// stream and nonterminals follow it
+constexpr int END = TAG_COUNT;
+constexpr int TERMINAL_COUNT = TAG_COUNT + 1;
+constexpr int FIRST_NONTERMINAL = TERMINAL_COUNT;
+
+extern const int START;
+// Production to expand for a nonterminal and a lookahead terminal, at
+// (nonterminal - FIRST_NONTERMINAL) * TERMINAL_COUNT + terminal; -1 if none
+extern const int16_t PREDICT[];
+// Right-hand side of production p: RHS[RHS_BEGIN[p]] up to
+// RHS[RHS_BEGIN[p + 1]], last symbol first
+extern const int16_t RHS[];
+extern const uint16_t RHS_BEGIN[];
+extern const char* const NONTERMINAL_NAMES[];
+
+}  // namespace ll1
+
+#endif // LL1_TABLES_H
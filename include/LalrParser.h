@@ -0,0 +1,28 @@
+#ifndef LALR_PARSER_H
+#define LALR_PARSER_H
+
+#include "Parser.h"
+#include <string>
+
+// LALR(1) recognizer generated by bison from grammar/grammar.y. Accepts the
+// same token streams as RecursiveDescendant but builds no outline, it is
+// there to compare parsing engines (see main --compare-parsers).
+class LalrParser : public Parser {
+public:
+    LalrParser(TokenStream* stream);
+    void parse() override;
+
+    // Called by the generated parser: the next token (nullptr at the end)
+    // and the message of a syntax error
+    Token* nextToken();
+    void syntaxError(const char* message);
+
+private:
+    bool started = false;       // Whether look was handed out already
+    std::string error_message;
+
+    // Runs the generated parser, defined in grammar/grammar.y
+    int run();
+};
+
+#endif // LALR_PARSER_H
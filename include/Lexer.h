@@ -1,54 +1,133 @@
 #ifndef LEXER_H
 #define LEXER_H
 
-#include <iostream>
 #include <string>
-#include <unordered_map>
-#include <fstream>
-#include <stack>
-#include <queue>
+#include <string_view>
 #include <memory>
+#include <memory_resource>
+#include <vector>
+#include "Indentation.h"
 #include "Token.h"
-#include "Word.h"
-#include "Num.h"
-#include "TokenStream.h"
+
+class Num;
+class SymbolTable;
+class TokenStream;
+class Word;
+
+// How a lexer recognizes tokens: the hand-written scan() or the DFA
+// generated from grammar/lexer.l. Both give the same tokens and errors.
+enum class ScannerBackend {
+    HandWritten,
+    Table
+};
 
 class Lexer {
     private:
         char peek = '\0';
-        std::ifstream source;
+        std::shared_ptr<std::string> buffer;  // Whole input, read once
+        std::string_view source;  // Text being scanned, a view of buffer
+        size_t pos = 0;           // Index in source of the character after peek
+        // Set once peek has run past the end of source. Not a character
+        // value: every byte, 0xFF included, can be in the input.
+        bool at_end = false;
         int line = 1;
+        int first_line = 1;      // Line number of the first line of source
         int column = 0;
         bool line_start = true;  // Added to track line start
-        int spaces = 0; // Added to track spaces and identation
-        std::stack<int> indent_stack;  // Stack to track indentation levels
-        std::queue<Token*> dedent_queue;  // Queue for pending dedent tokens
-        std::unordered_map<std::string, std::unique_ptr<Word>> words;
+        std::pmr::vector<LineIndent> indents;  // Per line of source, see measureIndentation
+        int depth = 0;            // Indentation levels open
+        int pending_dedents = 0;  // DEDENTs still to return after the first one
+        int tab_width = DEFAULT_TAB_WIDTH;
+        bool check_tabs = true;
+        // Keywords and identifiers; every stream filled by this lexer keeps
+        // the table alive, so its Words outlive the lexer if need be
+        std::shared_ptr<SymbolTable> symbols;
+        Token* tag_tokens;  // symbols->tagTokens(), looked up once
+        TokenStream* output = nullptr;  // Stream being generated, owns the literals
+        ScannerBackend backend = ScannerBackend::HandWritten;
+        // Per rule of the DFA, the token it returns: the Word of a literal
+        // rule (keywords, comparisons) or the shared token of its tag.
+        // Filled by setScanner.
+        std::pmr::vector<Token*> rule_tokens;
+        Word* op_eq = nullptr;
+        Word* op_ne = nullptr;
+        Word* op_lt = nullptr;
+        Word* op_le = nullptr;
+        Word* op_gt = nullptr;
+        Word* op_ge = nullptr;
         
-        void reserve(Word w);
+        Word* reserve(const Word& w);
+        Token* token(Tag tag);
+        std::string& writableBuffer();
+        void start(std::string_view text, int first_line);
         void readch();
         bool readch(char c);
+        void advance(std::ptrdiff_t n);
+        char peekNext() const;
 
-        void skipWhitespace(bool at_line_start);
-        Token* handlePendingDedents();
-        Token* handleDedents();
-        Token* handleIdent();
+        void skipWhitespace();
+        Token* handleIndentation();
         Token* handleNewLines();
         void handleComments();
         Token* handleEOF();
         Token* handleVariables(int tag);
+        Token* word(std::string_view name, int tag);
         Token* handleNumbers();
+        Num* makeNumber(const char* begin, const char* literal_end, int base, bool is_float, bool imaginary);
         Token* handleStrings();
         Token* handleOperators();
         Token* handlePunctuation();
-        Word* findKeyword(const std::string& word);
+        Word* findKeyword(std::string_view word);
         Token* scan();
+        Token* scanTable();
         
     public:
+        // A lexer with no input yet, see reset()/resetText()
+        Lexer() : Lexer(std::pmr::get_default_resource()) {}
+        // A new symbol table and the per-line tables are allocated from
+        // resource, which has to outlive the lexer and every stream using
+        // its Words
+        explicit Lexer(std::pmr::memory_resource* resource);
+        // Interns keywords and identifiers into symbols, which other lexers
+        // may share (one at a time, see SymbolTable)
+        explicit Lexer(std::shared_ptr<SymbolTable> symbols,
+                       std::pmr::memory_resource* resource = std::pmr::get_default_resource());
         Lexer(std::string filename);
         ~Lexer();
+        Lexer(const Lexer&) = delete;
+        Lexer& operator=(const Lexer&) = delete;
+
+        const std::shared_ptr<SymbolTable>& symbolTable() const { return this->symbols; }
+
+        // Rewind to the start of a new input. The keyword table, the
+        // interned identifiers and the buffers are kept, so a lexer reused
+        // across many inputs stops allocating once it has warmed up.
+        // Streams filled earlier keep their tokens valid on their own.
+        void reset(const std::string& filename);
+        void resetText(std::string_view text);
+        // Lexes buffer in place, e.g. a file from FileLoader
+        void resetBuffer(std::shared_ptr<std::string> buffer);
+        // Lexes only [begin, end) of buffer, numbering lines from
+        // first_line; used to lex pieces of one file in parallel
+        void resetRange(std::shared_ptr<std::string> buffer, size_t begin, size_t end, int first_line);
         
+        // Tabs advance to the next multiple of width columns (8 by default,
+        // like Python). With check_tabs on (the default), indentation that
+        // compares differently depending on the tab size is an error, like
+        // Python's TabError. Both apply from the next generateStream.
+        void setTabWidth(int width);
+        void setTabCheck(bool check) { this->check_tabs = check; }
+
+        // HandWritten by default
+        void setScanner(ScannerBackend backend);
+        ScannerBackend scanner() const { return this->backend; }
+
+        // Reads a whole file into contents
+        static void readFile(const std::string& filename, std::string& contents);
+
         TokenStream* generateStream();
+        // Fills stream (cleared first, keeping its capacity) with the tokens
+        void generateStream(TokenStream& stream);
         
         int get_line() const { return line; }
         int get_column() const { return column; }
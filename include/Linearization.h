@@ -0,0 +1,156 @@
+#ifndef LINEARIZATION_H
+#define LINEARIZATION_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// The C3 linearization of a class, Python's method resolution order: the
+// class, then its ancestors in the order attribute lookup tries them.
+//
+// It is built from the linearizations of the parents, which have to be
+// built first and to outlive it. The part the merge decides is stored and
+// the rest is shared with the ancestor it ends with, so a class with one
+// parent stores nothing and a deep chain takes memory linear in its length.
+// Class is whatever identifies a class, hashable and cheap to copy.
+template <typename Class>
+class Linearization {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Class;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Class*;
+        using reference = const Class&;
+
+        iterator(const Linearization* lin = nullptr, size_t index = 0) : lin(lin), index(index) {}
+
+        const Class& operator*() const {
+            return this->index == 0 ? this->lin->self : this->lin->merged[this->index - 1];
+        }
+        iterator& operator++() {
+            if (++this->index > this->lin->merged.size()) {
+                this->lin = this->lin->rest;
+                this->index = 0;
+            }
+            return *this;
+        }
+        bool operator==(const iterator& other) const {
+            return this->lin == other.lin && this->index == other.index;
+        }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class Linearization;
+        const Linearization* lin;
+        size_t index;
+    };
+
+    // Linearizes self given the linearizations of its parents, in the order
+    // they are listed. Parents listed twice count once. A hierarchy Python
+    // would reject, where no order keeps every parent before its own
+    // parents, gets the classes the merge could not place in the order
+    // they are first found.
+    void build(Class self, std::vector<const Linearization*> parents) {
+        this->self = self;
+        this->merged.clear();
+        this->rest = nullptr;
+        std::unordered_set<const Linearization*> listed;
+        parents.erase(std::remove_if(parents.begin(), parents.end(), [&](const Linearization* p) {
+            return !listed.insert(p).second;
+        }), parents.end());
+        if (parents.size() == 1) {
+            this->rest = parents[0];
+            return;
+        }
+
+        // The lists merged: each parent's linearization, then the parents
+        // themselves, parents[next..]. in_tail counts the lists a class
+        // appears in after their head; only a class that is in no tail
+        // can be placed.
+        std::vector<iterator> lists;
+        std::unordered_map<Class, size_t> in_tail;
+        for (const Linearization* parent : parents) {
+            lists.push_back(parent->begin());
+            for (iterator it = ++parent->begin(); it != iterator(); ++it) {
+                in_tail[*it]++;
+            }
+        }
+        for (size_t i = 1; i < parents.size(); i++) {
+            in_tail[parents[i]->self]++;
+        }
+        size_t next = 0;
+
+        while (true) {
+            // Once every list left is the same whole linearization, it is
+            // the rest of this one too
+            const iterator* shared = nullptr;
+            bool same = true;
+            for (const iterator& list : lists) {
+                if (list != iterator()) {
+                    same = same && (!shared || list == *shared);
+                    shared = shared ? shared : &list;
+                }
+            }
+            if (!shared) {
+                return;
+            }
+            if (same && shared->index == 0 &&
+                (next == parents.size() || (next + 1 == parents.size() && parents[next]->self == **shared))) {
+                this->rest = shared->lin;
+                return;
+            }
+
+            // The head of the first list that is in no tail. A parent's
+            // head is itself until placed, so the parents list never has
+            // a head the other lists lack.
+            const iterator* found = nullptr;
+            for (const iterator& list : lists) {
+                if (list != iterator() && in_tail[*list] == 0) {
+                    found = &list;
+                    break;
+                }
+            }
+            if (!found) {
+                appendRemaining(lists);
+                return;
+            }
+            Class head = **found;
+            this->merged.push_back(head);
+            for (iterator& list : lists) {
+                if (list != iterator() && *list == head && ++list != iterator()) {
+                    in_tail[*list]--;
+                }
+            }
+            if (next < parents.size() && parents[next]->self == head && ++next < parents.size()) {
+                in_tail[parents[next]->self]--;
+            }
+        }
+    }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(); }
+
+private:
+    Class self{};
+    std::vector<Class> merged;  // Classes after self decided by the merge
+    const Linearization* rest = nullptr;  // Linearization of the classes after those
+
+    void appendRemaining(const std::vector<iterator>& lists) {
+        std::unordered_set<Class> placed(this->merged.begin(), this->merged.end());
+        placed.insert(this->self);
+        for (iterator list : lists) {
+            for (; list != iterator(); ++list) {
+                if (placed.insert(*list).second) {
+                    this->merged.push_back(*list);
+                }
+            }
+        }
+    }
+};
+
+#endif // LINEARIZATION_H
@@ -0,0 +1,29 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <string_view>
+
+// Read-only view of a whole file. On POSIX systems the file is mapped
+// with mmap, so opening is O(1) and pages are loaded on first use;
+// elsewhere it is read into memory.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return this->bytes; }
+    size_t size() const { return this->length; }
+    std::string_view view() const { return std::string_view(this->bytes, this->length); }
+
+private:
+    const char* bytes = nullptr;
+    size_t length = 0;
+    bool mapped = false;
+    std::string fallback;
+};
+
+#endif // MAPPED_FILE_H
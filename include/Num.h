@@ -5,8 +5,19 @@
 
 class Num : public Token {
 public:
-    int value;
-    Num(int v);
+    enum class Kind {
+        Int,        // 42, 0x2a, 0o52, 0b101010, 1_000
+        Float,      // 4.2, .5, 1e10
+        Imaginary   // 4.2j
+    };
+
+    Kind kind = Kind::Int;
+    long long value = 0;  // Int value
+    double real = 0.0;    // Float/Imaginary value
+    bool big = false;     // Int too large for value, real holds an approximation
+
+    Num(long long v);
+    Num(double v, Kind kind);
     std::string toString() override;
 };
 
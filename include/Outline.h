@@ -0,0 +1,72 @@
+#ifndef OUTLINE_H
+#define OUTLINE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Ast.h"
+#include "TypeHint.h"
+
+// Decorators the grammar knows about, as bit flags
+enum Decorator : unsigned {
+    DECORATOR_PROPERTY = 1u << 0,
+    DECORATOR_STATICMETHOD = 1u << 1,
+    DECORATOR_CLASSMETHOD = 1u << 2,
+    DECORATOR_ABSTRACTMETHOD = 1u << 3
+};
+
+struct ParamInfo {
+    std::string name;   // Without the * or ** of *args/**kwargs
+    const TypeNode* type = nullptr;  // Type hint, null if none
+    int stars = 0;      // 1 for *args, 2 for **kwargs
+    bool has_default = false;
+};
+
+struct MethodInfo {
+    std::string name;
+    unsigned decorators = 0;       // Decorator flags
+    std::vector<ParamInfo> params; // Including self/cls
+    const TypeNode* return_type = nullptr;  // Null if none
+    int32_t body = -1;             // Body node in Outline::ast, -1 if bodies were not parsed
+};
+
+struct ClassInfo {
+    std::string name;
+    std::vector<std::string> parents;
+    std::vector<MethodInfo> methods;
+};
+
+// An import statement of the module level code, one per imported module
+struct ImportInfo {
+    std::string module;  // Dotted name, empty in "from . import x"
+    int level = 0;       // Leading dots of a relative import
+    // Names of "from module import ...", each with the name it is bound
+    // to (the one after "as", else itself). A single "*" for a star
+    // import, none for "import module".
+    std::vector<std::pair<std::string, std::string>> names;
+};
+
+// Classes and functions recognized by RecursiveDescendant in one file
+struct Outline {
+    std::vector<ClassInfo> classes;
+    std::vector<MethodInfo> functions;  // Methods outside any class
+    std::vector<ImportInfo> imports;    // In the code around the definitions
+    // Syntax trees of the method bodies, if the parser was asked for them.
+    // Their tokens are positions in the stream that was parsed.
+    std::vector<AstNode> ast;
+    // Nodes of the type hints above: the parser's table, or the one shared
+    // by a whole project once adopted; null if there are none. Copies of
+    // the outline share the table.
+    std::shared_ptr<TypeTable> types;
+};
+
+// Points the hints of methods to the equal nodes of table, adding the ones
+// it lacks
+void adoptTypes(std::vector<MethodInfo>& methods, TypeTable& table);
+// The same for every method of outline, which then shares table and lets
+// go of its own
+void adoptTypes(Outline& outline, const std::shared_ptr<TypeTable>& table);
+
+#endif // OUTLINE_H
@@ -0,0 +1,61 @@
+#ifndef PARALLEL_LEXER_H
+#define PARALLEL_LEXER_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Lexer.h"
+#include "TokenStream.h"
+
+// Place where a source can be cut so that its pieces lex independently
+struct SplitPoint {
+    size_t offset;  // Start of the line
+    int line;       // Its line number
+};
+
+// Finds the starts of the lines at indentation 0 that begin with class,
+// def or a decorator. Strings (including triple-quoted docstrings) and
+// comments are skipped, so a line inside a docstring is never a split point.
+std::vector<SplitPoint> findSplitPoints(std::string_view source);
+
+// Lexes one large file with several threads. The file is cut at top-level
+// split points into one chunk per thread, each chunk gets its own Lexer
+// (and so its own indent stack) and the chunk streams are concatenated.
+// Every chunk starts at indentation 0 and ends with the DEDENTs its lexer
+// emits at end of input, which are the same DEDENTs the sequential lexer
+// emits before the first token of the next chunk, so the result matches
+// Lexer::generateStream token for token.
+//
+// Like with Lexer, the stream keeps the symbol tables of the chunk lexers
+// alive, so it may outlive the ParallelLexer.
+class ParallelLexer {
+public:
+    // threads = 0 uses one thread per hardware thread
+    explicit ParallelLexer(const std::string& filename, unsigned threads = 0);
+
+    TokenStream* generateStream();
+    void generateStream(TokenStream& stream);
+
+    // Passed on to the lexer of every chunk, see Lexer
+    void setTabWidth(int width) { this->tab_width = width; }
+    void setTabCheck(bool check) { this->check_tabs = check; }
+    void setScanner(ScannerBackend backend) { this->backend = backend; }
+
+    // Chunks used by the last generateStream
+    size_t chunkCount() const { return chunks; }
+
+    // Files smaller than this are not worth splitting
+    static constexpr size_t MIN_CHUNK_BYTES = 64 * 1024;
+
+private:
+    std::shared_ptr<std::string> buffer;
+    unsigned threads;
+    size_t chunks = 0;
+    int tab_width = DEFAULT_TAB_WIDTH;
+    bool check_tabs = true;
+    ScannerBackend backend = ScannerBackend::HandWritten;
+    std::vector<std::unique_ptr<Lexer>> lexers;
+};
+
+#endif // PARALLEL_LEXER_H
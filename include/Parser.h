@@ -1,16 +1,17 @@
 #ifndef PARSER_H
 #define PARSER_H
 
-#include "Lexer.h"
 #include "TokenStream.h"
-#include <iostream>
+#include <string>
 
 class Parser {
     public:
-        // Constructor que acepta TokenStream
+        // Constructor que acepta TokenStream (o nullptr, ver reset())
         Parser(TokenStream* stream);
         virtual ~Parser() = default;
         virtual void parse() = 0;
+        // Rebinds the parser to another stream, starting at its first token
+        void reset(TokenStream* stream);
 
     protected:
         TokenStream* stream;
@@ -18,7 +19,7 @@ class Parser {
 
         void move();
         void match(int tag);
-        void error(const std::string& message);
+        [[noreturn]] void error(const std::string& message);
         void debug(const std::string& message);
         bool isType(int tag);
 };
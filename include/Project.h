@@ -0,0 +1,66 @@
+#ifndef PROJECT_H
+#define PROJECT_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "FileLoader.h"
+#include "Outline.h"
+#include "SemanticAnalyzer.h"
+
+// A .py file of a project
+struct Module {
+    std::string path;
+    std::string name;        // Dotted, from the path under its root (pkg/__init__.py is pkg)
+    bool package = false;    // An __init__.py
+    Outline outline;
+    std::string error;       // Lex or parse error, empty if none
+    std::vector<uint32_t> imports;  // Modules of the project it imports, sorted
+    std::vector<Diagnostic> diagnostics;
+};
+
+// Whole-project analysis. Every module is parsed, its imports resolved to
+// the modules of the project, and its semantic checks run with the classes
+// it imports from them in view, so a subclass is checked against a base
+// class defined in another file.
+//
+// The work is scheduled on the import graph: parses are independent and
+// start at once, and the checks of a module start as soon as those of the
+// modules it imports are done, on whichever thread is free. Modules in an
+// import cycle are checked one after the other once nothing else can run,
+// each seeing the classes of the modules of the cycle already checked.
+class Project {
+public:
+    // Adds root if it is a file, or every .py file under it. Module names
+    // are relative to root.
+    void addRoot(const std::string& root);
+
+    // Parses and checks every module with the given number of threads
+    // (0 = one per hardware thread), reading the files with io
+    void analyze(unsigned threads = 0, FileLoader::Backend io = FileLoader::Backend::Auto);
+
+    const std::vector<Module>& modules() const { return this->all; }
+
+    // The module with the dotted name, -1 if there is none
+    int64_t find(const std::string& name) const;
+
+    // Modules in the order their checks finished: each one after the
+    // modules it imports, but for import cycles
+    const std::vector<uint32_t>& order() const { return this->finished; }
+
+private:
+    std::vector<Module> all;
+    std::unordered_map<std::string, uint32_t> names;
+    std::vector<uint32_t> finished;
+    // Per module, once checked: the tables of its classes, and the classes
+    // other modules can import from it (its own and the ones it imports)
+    std::vector<std::vector<SemanticAnalyzer::MethodTable>> tables;
+    std::vector<SemanticAnalyzer::ImportedClasses> exports;
+
+    bool target(uint32_t id, const ImportInfo& import, std::string& name) const;
+    void resolveImports(uint32_t id);
+    void check(uint32_t id, const std::vector<uint32_t>& checked, SemanticAnalyzer& analyzer);
+};
+
+#endif // PROJECT_H
@@ -2,13 +2,35 @@
 #define RECURSIVE_DESCENDANT_H
 
 #include "Parser.h"
+#include "Outline.h"
+#include <string_view>
 
 class RecursiveDescendant : public Parser {
 public:
     RecursiveDescendant(TokenStream* stream);
     void parse();
 
+    // With bodies on, method bodies are parsed into syntax trees (see
+    // Ast.h) instead of being skipped, and a body that is not valid Python
+    // makes parse() throw. Off by default.
+    void setParseBodies(bool on) { parse_bodies = on; }
+
+    // Classes and methods found by the last parse(). If it threw, holds
+    // what was recognized before the error.
+    const Outline& outline() const { return result; }
+
 private:
+    Outline result;
+    int current_class = -1;     // Index in result.classes of the class being parsed
+    unsigned decorators = 0;    // Decorators of the method being parsed
+    MethodInfo* current_method = nullptr;
+    bool parse_bodies = false;
+    int brackets = 0;           // Open ( [ { in the body being parsed
+    int layout_debt = 0;        // INDENTs minus DEDENTs dropped inside brackets
+
+    std::string_view lexeme() const;
+    void beginMethod();
+
     // Grammar
     void program();
     void elements();
@@ -33,6 +55,9 @@ private:
     void paramName();
     void moreParams();
     void typeHint();
+    const TypeNode* typeExpression();
+    void typeNamePart();
+    void typeList(std::vector<const TypeNode*>& types);
     void defaultValue();
     void returnType();
     void methodSuite();
@@ -46,6 +71,69 @@ private:
     void skipDefault();
     void preSkipStatements();
     void postSkipStatements();
+    void recordImport();
+    bool importName(std::string& name);
+
+    // Method bodies, with setParseBodies(true). Line breaks and indentation
+    // inside brackets are not significant in Python, but the lexer does not
+    // join those lines: advance() drops them, and drops the DEDENTs (or
+    // INDENTs) later on that only balance the ones dropped.
+    void advance();
+    void skipLayout();
+    void expect(Tag tag);
+    bool isTag(Tag tag) const;
+    bool isWord(const char* text) const;
+    bool isName() const;
+    bool startsExpression() const;
+    bool startsComprehension() const;
+    Token* lookAhead(size_t distance) const;
+    uint32_t here() const;
+    int32_t node(AstKind kind, uint32_t token, AstOp op = AstOp::None);
+    void append(int32_t parent, int32_t& last, int32_t child);
+    void openBracket();
+    void closeBracket(Tag tag);
+
+    int32_t block();
+    int32_t suite();
+    int32_t statement();
+    int32_t simpleStatement();
+    void endOfLine();
+    int32_t ifStatement();
+    int32_t whileStatement();
+    int32_t forStatement();
+    int32_t tryStatement();
+    int32_t withStatement();
+    int32_t importStatement();
+    int32_t fromImport();
+    int32_t alias();
+    int32_t dottedName();
+    int32_t definition();
+    void parameters(int32_t parent, int32_t& last, Tag close, bool annotated);
+    int32_t expressionStatement();
+    int augmentedAssign(AstOp& op) const;
+
+    // What a target is checked for: an assignment (for and with targets
+    // too), a del, an augmented assignment or an annotation
+    enum class TargetUse { Assign, Delete, Augmented, Annotated };
+    void checkTarget(int32_t target, TargetUse use);
+
+    int32_t expressions(int min_power = 1);
+    int32_t starExpression(int min_power = 1);
+    int32_t expression(int min_power = 1);
+    int32_t prefix();
+    int32_t postfix(int32_t left);
+    bool infix(AstOp& op, int& power, int& length) const;
+    int32_t strings();
+    int32_t parenthesized();
+    int32_t listDisplay();
+    int32_t braceDisplay();
+    int32_t comprehension(int32_t parent, int32_t last);
+    int32_t call(int32_t function);
+    void arguments(int32_t parent, int32_t& last);
+    int32_t subscript(int32_t value);
+    int32_t sliceItem();
+    int32_t lambda();
+    int32_t yieldExpression();
 };
 
 #endif
\ No newline at end of file
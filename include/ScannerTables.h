@@ -0,0 +1,36 @@
+#ifndef SCANNER_TABLES_H
+#define SCANNER_TABLES_H
+
+#include <cstdint>
+#include "Token.h"
+
+// DFA scanner of the Lexer with ScannerBackend::Table, generated at build
+// time from grammar/lexer.l by scripts/gen_scanner.py.
+namespace scanner {
+
+// What the lexer does with the text a rule matched
+enum class Action : uint8_t {
+    Skip,     // Whitespace and comments
+    Newline,
+    Token,    // A token of the rule's tag, or its Word if the rule is a literal
+    Error     // Throws the rule's message
+};
+
+struct Rule {
+    Action action;
+    int tag;           // Tag of the token, -1 if none
+    const char* text;  // The literal the rule matches, or the error message
+};
+
+// In the order of lexer.l, which is the priority between matches of the
+// same length
+extern const int RULE_COUNT;
+extern const Rule RULES[];
+
+// Runs the DFA from begin and returns the rule of the longest match, with
+// match_end set to its end, or -1 if no rule matches a prefix of the text
+int match(const char* begin, const char* end, const char*& match_end);
+
+}  // namespace scanner
+
+#endif // SCANNER_TABLES_H
@@ -0,0 +1,100 @@
+#ifndef SEMANTIC_ANALYZER_H
+#define SEMANTIC_ANALYZER_H
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "Linearization.h"
+#include "Outline.h"
+
+struct Diagnostic {
+    enum class Kind {
+        UnimplementedAbstract,
+        DuplicateMethod,
+        PropertyWithParameters,
+        OverrideArity,
+        OverrideType
+    };
+
+    Kind kind;
+    std::string class_name;  // Empty for functions outside classes
+    std::string method;
+    std::string message;
+
+    std::string toString() const;
+};
+
+// OOP checks over the outline of a parsed file:
+//  - @abstractmethods inherited and not overridden by a concrete class
+//    (one that declares no @abstractmethod and has no subclasses)
+//  - methods defined twice in the same class
+//  - @property methods taking parameters besides self
+//  - overrides that cannot be called with the arguments the method they
+//    override accepts: more required or fewer total parameters
+//    (__init__ and methods with *args/**kwargs excepted)
+//  - overrides whose parameter hints reject what the overridden method's
+//    accept, or whose return hint is not one its callers expect, for hints
+//    made of builtin types only
+//
+// Parents are looked up among the classes of the outline, then among the
+// classes imported from other modules if any, so names like ABC or object
+// that are not defined there are ignored. Classes are visited once, each
+// one after its parents, keeping the methods it defines in a hash table
+// and its C3 linearization, merged from those of its parents; inherited
+// methods are looked up along it as Python does, and nothing is copied
+// down a single-inheritance chain.
+class SemanticAnalyzer {
+public:
+    struct Visible {
+        const MethodInfo* method;
+        const ClassInfo* owner;
+    };
+    // Methods a class defines, by name, and the tables of the class and
+    // its ancestors in method resolution order. The class sees the methods
+    // of the first table along it that defines each name.
+    struct MethodTable {
+        std::unordered_map<std::string_view, Visible> own;
+        Linearization<const MethodTable*> mro;
+        bool abstract = false;  // Some method it sees is an @abstractmethod
+
+        // The method name refers to in the class, nullptr if none
+        const Visible* find(std::string_view name) const;
+        // The same, among the inherited methods only
+        const Visible* inherited(std::string_view name) const;
+        // Every method the class sees, one per name
+        std::vector<Visible> all() const;
+    };
+    // Classes of other modules by the name they are imported as, given by
+    // their tables from an earlier analyze() (see takeTables())
+    using ImportedClasses = std::unordered_map<std::string, const MethodTable*>;
+
+    std::vector<Diagnostic> analyze(const Outline& outline, const ImportedClasses* imported = nullptr);
+
+    // Tables of the classes of the last analyzed outline, in its order.
+    // They point into that outline, which has to outlive them.
+    std::vector<MethodTable> takeTables() { return std::move(this->visible); }
+
+private:
+    const Outline* outline = nullptr;
+    const ImportedClasses* imported = nullptr;
+    std::unordered_map<std::string_view, size_t> class_ids;
+    std::vector<MethodTable> visible;
+    std::vector<int> state;  // 0 not visited, 1 visiting, 2 done
+    std::vector<bool> has_children;
+    // Classes of the outline defining each method name, and whether a
+    // class has ancestors in other modules: an override can only have a
+    // base if some other class defines its name
+    std::unordered_map<std::string_view, uint32_t> definers;
+    std::vector<bool> has_imported;
+    std::vector<Diagnostic> diagnostics;
+
+    void visit(size_t cls);
+    void finish(size_t cls);
+    void checkMethods(const ClassInfo* owner, const std::vector<MethodInfo>& methods);
+    void checkOverride(const ClassInfo& cls, const MethodInfo& method, const Visible& base);
+    void checkOverrideTypes(const ClassInfo& cls, const MethodInfo& method, const Visible& base);
+    void report(Diagnostic::Kind kind, const ClassInfo* cls, const MethodInfo& method, std::string message);
+};
+
+#endif // SEMANTIC_ANALYZER_H
@@ -0,0 +1,119 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include "Token.h"
+
+// Phases of the front end that can be timed. Phases nest: KeywordLookup
+// and StreamGrowth run inside Scan, so their time is also counted there.
+enum class Phase {
+    FileRead,
+    Indentation,
+    Scan,
+    KeywordLookup,
+    StreamGrowth,
+    Parse,
+    COUNT
+};
+
+// A counter that only its own thread writes but any thread may read:
+// snapshot() reads the counters of threads that are still running. Relaxed
+// atomics make that read well-defined, and since there is a single writer
+// an increment is a plain load and store, not a locked add.
+class StatCounter {
+public:
+    StatCounter& operator+=(uint64_t n) {
+        this->value.store(this->value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        return *this;
+    }
+    StatCounter& operator++() { return *this += 1; }
+    uint64_t load() const { return this->value.load(std::memory_order_relaxed); }
+    void clear() { this->value.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value{0};
+};
+
+// Counters and phase timers of one thread, see Stats::local()
+struct ThreadStats {
+    StatCounter phase_ns[static_cast<int>(Phase::COUNT)];
+    StatCounter phase_calls[static_cast<int>(Phase::COUNT)];
+    StatCounter tokens_by_tag[TAG_COUNT];
+    StatCounter bytes_read;
+    StatCounter files_read;
+    StatCounter keyword_lookups;
+    StatCounter keyword_hits;
+    StatCounter word_inserts;
+    StatCounter stream_regrowths;
+
+    ThreadStats() = default;
+    ~ThreadStats();
+    ThreadStats(const ThreadStats&) = delete;
+    ThreadStats& operator=(const ThreadStats&) = delete;
+
+    bool registered = false;
+};
+
+// Totals of the counters and phase timers. Every thread that records
+// something gets its own ThreadStats, so the hot paths never synchronize;
+// snapshot() adds up all of them when the numbers are dumped.
+class Stats {
+public:
+    uint64_t phase_ns[static_cast<int>(Phase::COUNT)] = {};
+    uint64_t phase_calls[static_cast<int>(Phase::COUNT)] = {};
+    uint64_t tokens_by_tag[TAG_COUNT] = {};
+    uint64_t bytes_read = 0;
+    uint64_t files_read = 0;
+    uint64_t keyword_lookups = 0;
+    uint64_t keyword_hits = 0;
+    uint64_t word_inserts = 0;
+    uint64_t stream_regrowths = 0;
+
+    // Stats of the calling thread
+    static ThreadStats& local();
+    // Sum of the stats of every thread, including threads that already
+    // exited; threads still running may add to theirs meanwhile
+    static Stats snapshot();
+    // Clears the stats of every thread. Counts a thread makes at the same
+    // time may survive it.
+    static void resetAll();
+
+    void merge(const Stats& other);
+    void merge(const ThreadStats& other);
+    std::string toJson() const;
+};
+
+// Adds the time between construction and destruction to a phase
+class PhaseTimer {
+public:
+    explicit PhaseTimer(Phase phase)
+        : phase(phase), start(std::chrono::steady_clock::now()) {}
+    ~PhaseTimer();
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+    Phase phase;
+    std::chrono::steady_clock::time_point start;
+};
+
+// Instrumentation hooks. They only do something when the library is built
+// with OOP_STATS defined (CMake: -DOOP_ENABLE_STATS=ON, make: STATS=1);
+// otherwise they expand to nothing and cost nothing.
+#ifdef OOP_STATS
+#define STATS_CONCAT_(a, b) a##b
+#define STATS_CONCAT(a, b) STATS_CONCAT_(a, b)
+#define STATS_TIMER(phase) PhaseTimer STATS_CONCAT(stats_timer_, __LINE__)(phase)
+#define STATS_ADD(counter, n) (Stats::local().counter += (n))
+#define STATS_TOKEN(tag) (++Stats::local().tokens_by_tag[(tag)])
+#else
+#define STATS_TIMER(phase) ((void)0)
+#define STATS_ADD(counter, n) ((void)0)
+#define STATS_TOKEN(tag) ((void)0)
+#endif
+
+#endif // STATS_H
@@ -0,0 +1,20 @@
+#ifndef STR_H
+#define STR_H
+
+#include <string>
+#include <string_view>
+#include "Token.h"
+
+// String or docstring literal. The token only points at the text between
+// the quotes in the source buffer (which the TokenStream keeps alive);
+// escape sequences are processed when the value is asked for.
+class Str : public Token {
+public:
+    std::string_view raw;  // Text between the quotes, as written
+
+    Str(std::string_view raw, int tag);
+    std::string value() const;
+    std::string toString() override;
+};
+
+#endif // STR_H
@@ -0,0 +1,52 @@
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "Word.h"
+
+// Interner for the shared tokens: one Word per keyword or identifier
+// lexeme and one Token per tag without a lexeme (NEWLINE, COLON...), owned
+// by the table and shared by every token slot that names them. Lexers hold
+// their table through a shared_ptr and every stream they fill keeps it
+// alive too, so these tokens stay valid as long as any stream or lexer
+// using them does, whatever order they are destroyed in.
+//
+// Words and the characters of their lexemes are carved from a monotonic
+// pool over the table's resource: interning is a pointer bump, and the
+// table gives the pool's blocks back at once when it goes, without
+// visiting its Words.
+//
+// Not thread-safe: a table shared by several lexers must not be used by two
+// of them at the same time.
+class SymbolTable {
+public:
+    explicit SymbolTable(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    // Makes a table whose Words, index and control block all live in resource
+    static std::shared_ptr<SymbolTable> create(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    // The Word for lexeme, or nullptr if it was never interned
+    Word* find(std::string_view lexeme) const;
+    // The Word for lexeme, made with tag if it is new
+    Word* intern(std::string_view lexeme, int tag);
+    size_t size() const { return this->words.size(); }
+
+    // The shared token of a tag that carries nothing but the tag; the
+    // array is indexed by tag
+    Token* tagTokens() { return this->tag_tokens.data(); }
+
+private:
+    std::pmr::memory_resource* resource;
+    std::pmr::monotonic_buffer_resource pool;  // Words and lexemes, never freed one by one
+    std::pmr::vector<Token> tag_tokens;
+    // Keyed by a view of each Word's own lexeme
+    std::pmr::unordered_map<std::string_view, Word*> words;
+};
+
+#endif // SYMBOL_TABLE_H
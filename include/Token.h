@@ -1,7 +1,6 @@
 #ifndef TOKEN_H
 #define TOKEN_H
 
-#include <iostream>
 #include <string>
 
 enum class Tag {
@@ -75,6 +74,12 @@ enum class Tag {
     IMPORT
 };
 
+// Number of entries in Tag, for tables indexed by tag
+constexpr int TAG_COUNT = static_cast<int>(Tag::IMPORT) + 1;
+
+// Name of a tag as written in the grammar (e.g. "CLASS", "NEWLINE")
+const char* tagName(int tag);
+
 class Token {
     public:
         int tag;
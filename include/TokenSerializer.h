@@ -0,0 +1,43 @@
+#ifndef TOKEN_SERIALIZER_H
+#define TOKEN_SERIALIZER_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include "TokenStream.h"
+
+// Binary format of a token stream, for caching lexed files and shipping
+// them between processes:
+//
+//   TokenFileHeader
+//   uint32_t offsets[string_count + 1]   string i is [offsets[i], offsets[i+1])
+//   char strings[string_bytes]           interned lexemes and literal texts
+//   uint8_t code[code_bytes]             one record per token
+//
+// A record starts with the varint (tag << 2 | kind), kind being what the
+// token carries: nothing, a Word string id, a Num, or a Str string id
+// (varints). A Num is one byte of Num::Kind (4 for big ints) followed by a
+// zigzag varint or the 8 bytes of a double.
+struct TokenFileHeader {
+    char magic[4];  // "OOPT"
+    uint32_t version;
+    uint32_t token_count;
+    uint32_t string_count;
+    uint32_t string_bytes;
+    uint32_t code_bytes;
+};
+
+// Appends the serialized form of every token of stream to out
+void serializeTokens(const TokenStream& stream, std::string& out);
+void saveTokens(const TokenStream& stream, const std::string& path);
+
+// Rebuilds the tokens stored in data into stream, replacing its contents.
+// Str tokens point into data, which owner has to keep alive: the stream
+// retains it. Words are created once per distinct lexeme and tag.
+void deserializeTokens(std::shared_ptr<const void> owner, std::string_view data, TokenStream& stream);
+
+// Maps a file written by saveTokens and loads it without copying the
+// string literals
+void loadTokens(const std::string& path, TokenStream& stream);
+
+#endif // TOKEN_SERIALIZER_H
@@ -1,27 +1,82 @@
 #ifndef TOKENSTREAM_H
 #define TOKENSTREAM_H
 
-#include <vector>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
 #include "Token.h"
 
+// Every allocation of a stream (its token list and the tokens it makes)
+// comes from the memory resource it was built with, so a caller can put a
+// stream on a std::pmr::monotonic_buffer_resource and drop it all at once.
 class TokenStream {
 private:
-    std::vector<std::unique_ptr<Token>> tokens;
+    // A token made by make(), destroyed and freed by the stream
+    struct Owned {
+        Token* token;
+        std::pmr::memory_resource* resource;  // The one it was allocated from
+        size_t size;
+        size_t alignment;
+    };
+
+    std::pmr::vector<Token*> tokens;
+    std::pmr::vector<Owned> owned;
+    std::pmr::vector<std::shared_ptr<const void>> retained;  // Storage tokens point into
     size_t current_pos = 0;
 
 public:
-    TokenStream() = default;
-    ~TokenStream() = default;
+    TokenStream() : TokenStream(std::pmr::get_default_resource()) {}
+    explicit TokenStream(std::pmr::memory_resource* resource);
+    ~TokenStream();
+    TokenStream(TokenStream&&) = default;
+    TokenStream(const TokenStream&) = delete;
+    TokenStream& operator=(const TokenStream&) = delete;
+    TokenStream& operator=(TokenStream&&) = delete;
+
+    std::pmr::memory_resource* resource() const { return this->tokens.get_allocator().resource(); }
 
-    void addToken(Token* token);
+    // Makes a token owned by the stream, in its memory resource. It is not
+    // appended yet, see add().
+    template <typename T, typename... Args>
+    T* make(Args&&... args) {
+        std::pmr::memory_resource* resource = this->resource();
+        void* memory = resource->allocate(sizeof(T), alignof(T));
+        T* token;
+        try {
+            token = ::new (memory) T(std::forward<Args>(args)...);
+        } catch (...) {
+            resource->deallocate(memory, sizeof(T), alignof(T));
+            throw;
+        }
+        adopt({token, resource, sizeof(T), alignof(T)});
+        return token;
+    }
+
+    // Appends a token, either made by make() or owned by someone else (the
+    // lexer's keyword/identifier table) that outlives the stream or is kept
+    // alive by retain()
+    void add(Token* token);
+    // Keeps owner alive as long as the stream, for tokens that hold views
+    // into it (e.g. Str tokens into the source buffer)
+    void retain(std::shared_ptr<const void> owner);
+    // Moves every token of other to the end of this stream. Tokens keep
+    // their memory, so the resource of other has to outlive this stream.
+    void append(TokenStream&& other);
     Token* peek() const;
     Token* next();
     void reset();
+    // Drops every token but keeps the allocated capacity for reuse
+    void clear();
     size_t size() const;
     Token* at(size_t pos) const;
     size_t position() const;
     void setPosition(size_t pos);
+
+private:
+    void adopt(const Owned& token);
+    static void destroy(const Owned& token);
 };
 
-#endif // TOKENSTREAM_H 
\ No newline at end of file
+#endif // TOKENSTREAM_H
@@ -0,0 +1,69 @@
+#ifndef TYPE_HINT_H
+#define TYPE_HINT_H
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// A parsed type hint. Nodes are hash-consed by TypeTable: two hints of one
+// table that mean the same type are the same node. Nodes of different
+// tables are compared with sameType.
+struct TypeNode {
+    enum class Kind {
+        Name,       // int, Foo, typing.List, None; forward references ("Foo") too
+        Generic,    // name[args]: list[int], dict[str, Any]
+        Union,      // Union[...] and Optional[...], flattened, members sorted by text
+        List,       // [args], the parameter list of Callable[[int, str], bool]
+        Ellipsis    // ... as in tuple[int, ...]
+    };
+
+    Kind kind;
+    std::string name;                   // Dotted name of Name and Generic
+    std::vector<const TypeNode*> args;  // Arguments of Generic, members of Union, items of List
+    std::string text;                   // Canonical spelling, e.g. "Optional[dict[str, Any]]"
+    size_t hash = 0;
+};
+
+// Whether a and b, possibly from different tables, are the same type: one
+// pointer comparison within a table, else a walk of both nodes
+bool sameType(const TypeNode* a, const TypeNode* b);
+
+// Type nodes of an Outline, filled by the parser that builds it, so parsers
+// running in parallel never share one. A project or class index then moves
+// the hints of all its outlines into one table (see adoptTypes in
+// Outline.h), where equal types of different files are the same node too.
+// Nodes stay where they are while a table grows. Not thread-safe.
+class TypeTable {
+public:
+    const TypeNode* name(std::string_view dotted);
+    // Optional[X] and Union[...] (also spelled typing.Optional/typing.Union)
+    // become unions
+    const TypeNode* generic(std::string_view dotted, std::vector<const TypeNode*> args);
+    // Nested unions are flattened and duplicates dropped; a union of one
+    // type is that type
+    const TypeNode* unionOf(std::vector<const TypeNode*> members);
+    const TypeNode* list(std::vector<const TypeNode*> items);
+    const TypeNode* ellipsis();
+    // The node of this table equal to one of another table
+    const TypeNode* adopt(const TypeNode* node);
+
+    size_t size() const { return nodes.size(); }
+
+private:
+    struct Hash {
+        size_t operator()(const TypeNode* node) const { return node->hash; }
+    };
+    struct Equal {
+        bool operator()(const TypeNode* a, const TypeNode* b) const;
+    };
+
+    std::deque<TypeNode> nodes;
+    std::unordered_set<const TypeNode*, Hash, Equal> index;
+
+    const TypeNode* intern(TypeNode::Kind kind, std::string_view name, std::vector<const TypeNode*> args);
+};
+
+#endif // TYPE_HINT_H
@@ -0,0 +1,63 @@
+#ifndef UNICODE_H
+#define UNICODE_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Classes of a byte for identifiers. Only ASCII bytes have one: bytes from
+// 0x80 up are UTF-8 sequences and go through the Unicode tables.
+enum CharClass : uint8_t {
+    CHAR_IDENT_START = 1,     // [A-Za-z_]
+    CHAR_IDENT_CONTINUE = 2,  // [A-Za-z0-9_]
+};
+
+struct AsciiClasses {
+    uint8_t of[256];
+
+    constexpr AsciiClasses() : of() {
+        for (int c = 0; c < 256; c++) {
+            bool letter = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+            bool digit = c >= '0' && c <= '9';
+            this->of[c] = static_cast<uint8_t>((letter ? CHAR_IDENT_START : 0) |
+                                               (letter || digit ? CHAR_IDENT_CONTINUE : 0));
+        }
+    }
+};
+
+inline constexpr AsciiClasses ASCII_CLASSES;
+
+// One lookup, no locale and no branch on the byte value
+inline bool isAsciiIdentStart(char c) {
+    return ASCII_CLASSES.of[static_cast<unsigned char>(c)] & CHAR_IDENT_START;
+}
+
+inline bool isAsciiIdentContinue(char c) {
+    return ASCII_CLASSES.of[static_cast<unsigned char>(c)] & CHAR_IDENT_CONTINUE;
+}
+
+inline bool isAscii(char c) {
+    return static_cast<unsigned char>(c) < 0x80;
+}
+
+// A closed range of code points
+struct UnicodeRange {
+    char32_t first;
+    char32_t last;
+};
+
+// Sorted XID_Start/XID_Continue ranges above ASCII, generated by
+// scripts/gen_unicode_tables.py into src/UnicodeTables.cpp
+extern const UnicodeRange XID_START[];
+extern const size_t XID_START_SIZE;
+extern const UnicodeRange XID_CONTINUE[];
+extern const size_t XID_CONTINUE_SIZE;
+
+// Decodes the UTF-8 sequence at [p, end) into cp. Returns its length in
+// bytes, or 0 if it is truncated, overlong, a surrogate or above U+10FFFF.
+int decodeUtf8(const char* p, const char* end, char32_t& cp);
+
+// Whether cp may start / continue an identifier (PEP 3131)
+bool isXidStart(char32_t cp);
+bool isXidContinue(char32_t cp);
+
+#endif // UNICODE_H
@@ -2,12 +2,15 @@
 #define WORD_H
 #include "Token.h"
 
-#include <iostream>
+#include <string>
+#include <string_view>
 
 class Word : public Token {
     public:
-        std::string lexeme = "";
-        Word(std::string, int);
+        // Characters owned by whoever made the Word: the SymbolTable that
+        // interned it, the token file it was loaded from, or a literal
+        std::string_view lexeme;
+        Word(std::string_view, int);
         std::string toString() override;
         
         // Python keywords
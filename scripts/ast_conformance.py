@@ -0,0 +1,277 @@
+"""Differential harness against CPython's ast module: runs main --verdicts
+--bodies and ast.parse over the same inputs, reports where one accepts what
+the other rejects with minimized repro inputs, and the distribution of the
+per-input speedup of main over ast.parse:
+
+    python3 scripts/ast_conformance.py [--main build/bin/main] [--jsonl <dataset.jsonl[.gz]>]...
+                                       [--generate N] [--seed S] [--minimize N] [--out DIR]
+                                       [--save FILE] [--baseline FILE] [<file_or_dir>...]
+
+Inputs are the snippets of the datasets (scripts/dataset.jsonl if none is
+given), N files made by scripts/gen_corpus.py and any files or directories.
+
+The parser recognizes a subset of Python, so many inputs that CPython
+accepts are rejected on purpose ("cpython only"). Inputs it accepts but
+CPython rejects ("main only") are bugs. Disagreements are shrunk by delta
+debugging (lines, then characters of short inputs) while they keep both
+verdicts, and written to the --out directory.
+
+Both sides are timed in process with the input already in memory, best of
+three runs: main lexes and parses, ast.parse tokenizes and builds the
+tree. --save writes main's verdicts, and --baseline compares them with a
+saved run and exits with 1 if any changed, to catch regressions from
+changes to the parser.
+"""
+import argparse
+import gzip
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+import warnings
+
+SCRIPTS_DIR = os.path.dirname(os.path.abspath(__file__))
+ROOT_DIR = os.path.dirname(SCRIPTS_DIR)
+RUNS = 3
+SCAFFOLD = b"class Scaffold:\n    def method(self):\n        pass\n\n"
+
+
+def open_dataset(path):
+    return gzip.open(path, "rb") if path.endswith(".gz") else open(path, "rb")
+
+
+def dataset_snippets(path):
+    """Snippets by name, path:line as main --verdicts names them"""
+    snippets = {}
+    with open_dataset(path) as f:
+        for number, line in enumerate(f, 1):
+            try:
+                code = json.loads(line).get("correct_code")
+            except (ValueError, AttributeError):
+                continue
+            if isinstance(code, str):
+                snippets["%s:%d" % (path, number)] = code.encode("utf-8")
+    return snippets
+
+
+def run_main(main, args):
+    """Verdicts of main by input name: (accepted, nanoseconds, error)"""
+    result = subprocess.run([main, "--verdicts", "--bodies"] + args, stdout=subprocess.PIPE, check=True)
+    verdicts = {}
+    for line in result.stdout.decode("utf-8", "replace").splitlines():
+        verdict, ns, name, error = line.split("\t", 3)
+        verdicts[name] = (verdict == "accept", int(ns), error)
+    return verdicts
+
+
+def run_main_on_sources(main, sources):
+    """Verdicts of main on each source, through a temporary dataset"""
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "candidates.jsonl")
+        with open(path, "w", encoding="utf-8") as f:
+            for source in sources:
+                text = source.decode("utf-8", "surrogateescape")
+                f.write(json.dumps({"correct_code": text}) + "\n")
+        verdicts = run_main(main, ["--jsonl=" + path])
+        return [verdicts.get("%s:%d" % (path, i + 1), (False, 0, "")) for i in range(len(sources))]
+
+
+def cpython_verdict(source):
+    """(accepted, nanoseconds, error) of ast.parse, best of RUNS"""
+    best = None
+    error = ""
+    for _ in range(RUNS):
+        start = time.perf_counter_ns()
+        try:
+            with warnings.catch_warnings():
+                warnings.simplefilter("ignore")
+                compile(source, "<input>", "exec", 0x400)  # ast.PyCF_ONLY_AST
+            error = ""
+        except (SyntaxError, ValueError, RecursionError, MemoryError) as e:
+            error = "%s: %s" % (type(e).__name__, e)
+        elapsed = time.perf_counter_ns() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return (not error, best, error)
+
+
+def ddmin(items, holds):
+    """Smallest sublist of items (1-minimal) that still holds, testing all
+    subsets and complements of a round in one call of holds"""
+    n = 2
+    while len(items) >= 2:
+        size = math.ceil(len(items) / n)
+        subsets = [items[i:i + size] for i in range(0, len(items), size)]
+        complements = [items[:i] + items[i + size:] for i in range(0, len(items), size)]
+        results = holds(subsets + complements)
+        if True in results:
+            k = results.index(True)
+            if k < len(subsets):
+                items, n = subsets[k], 2
+            else:
+                items, n = complements[k - len(subsets)], max(n - 1, 2)
+        elif n >= len(items):
+            break
+        else:
+            n = min(len(items), 2 * n)
+    return items
+
+
+def error_kind(error):
+    """Error message without its positions"""
+    return re.sub(r"\d+", "N", error)
+
+
+def minimize(main, source, ours, theirs):
+    """Shrinks source while both verdicts and the error messages (but for
+    their positions) stay the same. main only accepts files with at least
+    one definition, so inputs it rejects are shrunk after a valid class:
+    otherwise the empty file would be the smallest repro of any of them."""
+    prefix = b"" if ours[0] else SCAFFOLD
+    expected = (ours[0], error_kind(ours[2]), theirs[0], error_kind(theirs[2]))
+
+    def holds(join):
+        def test(candidates):
+            sources = [prefix + join(c) for c in candidates]
+            verdicts = run_main_on_sources(main, sources)
+            results = []
+            for verdict, candidate in zip(verdicts, sources):
+                cpython = cpython_verdict(candidate)
+                results.append((verdict[0], error_kind(verdict[2]), cpython[0], error_kind(cpython[2])) == expected)
+            return results
+        return test
+
+    if not holds(bytes)([list(source)])[0]:
+        prefix = b""
+    source = b"\n".join(ddmin(source.split(b"\n"), holds(b"\n".join)))
+    if len(source) <= 400:
+        source = bytes(ddmin(list(source), holds(bytes)))
+    return prefix + source
+
+
+def percentile(sorted_values, fraction):
+    return sorted_values[min(len(sorted_values) - 1, int(fraction * len(sorted_values)))]
+
+
+def report_speedups(title, ratios):
+    if not ratios:
+        return
+    ratios = sorted(ratios)
+    geomean = math.exp(sum(math.log(r) for r in ratios) / len(ratios))
+    print("%s: %d inputs, geometric mean %.2fx" % (title, len(ratios), geomean))
+    print("  min %.2fx  p10 %.2fx  p25 %.2fx  median %.2fx  p75 %.2fx  p90 %.2fx  max %.2fx" % (
+        ratios[0], percentile(ratios, 0.1), percentile(ratios, 0.25), percentile(ratios, 0.5),
+        percentile(ratios, 0.75), percentile(ratios, 0.9), ratios[-1]))
+    # Histogram in powers of two
+    buckets = {}
+    for r in ratios:
+        b = math.floor(math.log2(r))
+        buckets[b] = buckets.get(b, 0) + 1
+    width = max(buckets.values())
+    for b in range(min(buckets), max(buckets) + 1):
+        count = buckets.get(b, 0)
+        print("  %8s-%-6s %6d %s" % ("%gx" % 2.0 ** b, "%gx" % 2.0 ** (b + 1), count, "#" * (40 * count // width)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--main", default=os.path.join(ROOT_DIR, "build", "bin", "main"))
+    parser.add_argument("--jsonl", action="append", default=[])
+    parser.add_argument("--generate", type=int, default=100, help="files made by gen_corpus.py")
+    parser.add_argument("--seed", type=int, default=3)
+    parser.add_argument("--minimize", type=int, default=5, help="disagreements shrunk per direction")
+    parser.add_argument("--out", default=os.path.join(ROOT_DIR, "build", "conformance"))
+    parser.add_argument("--save", help="write main's verdicts to this file")
+    parser.add_argument("--baseline", help="compare main's verdicts with a saved file")
+    parser.add_argument("paths", nargs="*")
+    args = parser.parse_args()
+
+    if not os.path.exists(args.main):
+        sys.exit("%s is not built" % args.main)
+    datasets = args.jsonl or ([] if args.paths else [os.path.join(SCRIPTS_DIR, "dataset.jsonl")])
+
+    with tempfile.TemporaryDirectory() as tmp:
+        paths = list(args.paths)
+        if args.generate > 0:
+            corpus = os.path.join(tmp, "corpus")
+            subprocess.run([sys.executable, os.path.join(SCRIPTS_DIR, "gen_corpus.py"), corpus,
+                            "--files", str(args.generate), "--seed", str(args.seed)],
+                           stdout=subprocess.DEVNULL, check=True)
+            paths.append(corpus)
+
+        ours = {}
+        sources = {}
+        for dataset in datasets:
+            ours.update(run_main(args.main, ["--jsonl=" + dataset]))
+            sources.update(dataset_snippets(dataset))
+        if paths:
+            for path, verdict in run_main(args.main, paths).items():
+                # Generated files are named the same whatever the directory
+                name = "generated/" + os.path.relpath(path, corpus) if path.startswith(tmp) else path
+                ours[name] = verdict
+                with open(path, "rb") as f:
+                    sources[name] = f.read()
+
+        names = [name for name in ours if name in sources]
+        theirs = {name: cpython_verdict(sources[name]) for name in names}
+
+    counts = {}
+    disagreements = {"main only": [], "cpython only": []}
+    for name in names:
+        key = (ours[name][0], theirs[name][0])
+        counts[key] = counts.get(key, 0) + 1
+        if key == (True, False):
+            disagreements["main only"].append(name)
+        elif key == (False, True):
+            disagreements["cpython only"].append(name)
+
+    print("Inputs: %d" % len(names))
+    print("  both accept    %6d" % counts.get((True, True), 0))
+    print("  both reject    %6d" % counts.get((False, False), 0))
+    print("  cpython only   %6d  (outside the subset main recognizes)" % counts.get((False, True), 0))
+    print("  main only      %6d  (main accepts invalid Python)" % counts.get((True, False), 0))
+
+    os.makedirs(args.out, exist_ok=True)
+    for direction, found in disagreements.items():
+        if not found or args.minimize <= 0:
+            continue
+        print("\nMinimized %s disagreements (%d of %d) in %s:" % (
+            direction, min(args.minimize, len(found)), len(found), args.out))
+        for i, name in enumerate(found[:args.minimize]):
+            accepted = direction == "main only"
+            repro = minimize(args.main, sources[name], ours[name], theirs[name])
+            path = os.path.join(args.out, "%s-%d.py" % (direction.replace(" ", "-"), i + 1))
+            with open(path, "wb") as f:
+                f.write(repro)
+            error = ours[name][2] if not accepted else theirs[name][2]
+            print("  %s (%d -> %d bytes): %s" % (name, len(sources[name]), len(repro), error))
+            print("    %r" % repro.decode("utf-8", "replace")[:200])
+
+    print()
+    report_speedups("Speedup of main over ast.parse", [theirs[n][1] / max(ours[n][1], 1) for n in names])
+    report_speedups("Accepted by both", [theirs[n][1] / max(ours[n][1], 1) for n in names
+                                         if ours[n][0] and theirs[n][0]])
+    print("Total: main %.3f s, ast.parse %.3f s" % (
+        sum(ours[n][1] for n in names) / 1e9, sum(theirs[n][1] for n in names) / 1e9))
+
+    verdicts = {name: ours[name][0] for name in names}
+    if args.save:
+        with open(args.save, "w", encoding="utf-8") as f:
+            json.dump(verdicts, f, indent=0, sort_keys=True)
+    if args.baseline:
+        with open(args.baseline, encoding="utf-8") as f:
+            baseline = json.load(f)
+        changed = sorted(n for n in verdicts if n in baseline and baseline[n] != verdicts[n])
+        print("\nChanged since %s: %d" % (args.baseline, len(changed)))
+        for name in changed:
+            print("  %s: %s -> %s" % (name, "accept" if baseline[name] else "reject",
+                                      "accept" if verdicts[name] else "reject"))
+        if changed:
+            sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
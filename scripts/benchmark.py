@@ -0,0 +1,87 @@
+"""Times builds of main against each other on the same workloads, e.g. the
+plain, release (-O3 + LTO) and profile-guided binaries made by the Makefile,
+or one binary with different options:
+
+    python3 scripts/benchmark.py [--runs N] <corpus_dir> <main>...
+    python3 scripts/benchmark.py <corpus_dir> "main --scanner=hand" "main --scanner=table"
+
+Workloads: the dataset repeated into one large JSONL file (many small
+snippets), --emit=json over every file of corpus_dir (lexer, parser and
+emitter on mid-sized files) and --emit=bin over all of them concatenated
+(one large file). Use a corpus generated with another seed than the one
+make pgo trains on. Each workload reports the best wall time of N runs.
+"""
+import argparse
+import glob
+import os
+import shlex
+import subprocess
+import sys
+import time
+
+SCRIPTS_DIR = os.path.dirname(os.path.abspath(__file__))
+DATASET_COPIES = 30
+
+
+def prepare(corpus_dir):
+    files = sorted(glob.glob(os.path.join(corpus_dir, "*.py")))
+    if not files:
+        sys.exit("No .py files in %s (see scripts/gen_corpus.py)" % corpus_dir)
+
+    jsonl = os.path.join(corpus_dir, "dataset_x%d.jsonl" % DATASET_COPIES)
+    if not os.path.exists(jsonl):
+        with open(os.path.join(SCRIPTS_DIR, "dataset.jsonl"), encoding="utf-8") as f:
+            dataset = f.read()
+        with open(jsonl, "w", encoding="utf-8") as f:
+            f.write(dataset * DATASET_COPIES)
+
+    large = os.path.join(corpus_dir, "large.py.txt")  # Not picked up as *.py
+    if not os.path.exists(large):
+        with open(large, "w", encoding="utf-8") as out:
+            for path in files:
+                with open(path, encoding="utf-8") as f:
+                    out.write(f.read())
+
+    return [
+        ("dataset x%d (--jsonl)" % DATASET_COPIES, ["--jsonl=" + jsonl]),
+        ("%d files (--emit=json)" % len(files), ["--emit=json"] + files),
+        ("%d MB file (--emit=bin)" % (os.path.getsize(large) >> 20), ["--emit=bin", large]),
+    ]
+
+
+def best_time(command, runs):
+    best = None
+    for _ in range(runs):
+        start = time.perf_counter()
+        subprocess.run(command, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, check=True)
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--runs", type=int, default=5)
+    parser.add_argument("corpus_dir")
+    parser.add_argument("binaries", nargs="+", help="binary, with its options if quoted")
+    args = parser.parse_args()
+
+    binaries = [b for b in args.binaries if os.path.exists(shlex.split(b)[0])]
+    for missing in sorted(set(args.binaries) - set(binaries)):
+        print("Skipping %s (not built)" % missing)
+    if not binaries:
+        sys.exit(1)
+
+    workloads = prepare(args.corpus_dir)
+    width = max(len(b) for b in binaries)
+    for name, workload_args in workloads:
+        print(name)
+        baseline = None
+        for binary in binaries:
+            seconds = best_time(shlex.split(binary) + workload_args, args.runs)
+            baseline = baseline or seconds
+            print("  %-*s %8.3f s  %5.2fx" % (width, binary, seconds, baseline / seconds))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,155 @@
+"""Generates a synthetic corpus of Python files in the subset the parser
+recognizes (classes, decorated methods with type hints and defaults,
+bodies with control flow, literals of every kind and comments), used to
+train and benchmark optimized builds:
+
+    python3 scripts/gen_corpus.py <out_dir> [--files N] [--classes N] [--seed S]
+
+The same seed always gives the same corpus.
+"""
+import argparse
+import os
+import random
+
+TYPES = ["int", "float", "str", "bool", "list", "dict", "tuple", "set"]
+NAMES = ["value", "count", "items", "name", "total", "index", "data", "result",
+         "size", "key", "node", "left", "right", "parent", "config", "buffer"]
+OPS = ["+", "-", "*", "/", "%", "==", "!=", "<", "<=", ">", ">="]
+
+
+class Writer:
+    def __init__(self, rng):
+        self.rng = rng
+        self.lines = []
+
+    def line(self, depth, text):
+        self.lines.append("    " * depth + text)
+
+    def name(self):
+        return self.rng.choice(NAMES) + (str(self.rng.randrange(10)) if self.rng.random() < 0.3 else "")
+
+    def literal(self):
+        r = self.rng.random()
+        if r < 0.25:
+            return str(self.rng.randrange(100000))
+        if r < 0.35:
+            return hex(self.rng.randrange(1 << 32))
+        if r < 0.5:
+            return "%.3f" % (self.rng.random() * 1000)
+        if r < 0.55:
+            return "1_000_%03d" % self.rng.randrange(1000)
+        if r < 0.8:
+            return "'%s'" % self.name()
+        if r < 0.9:
+            return '"%s %s"' % (self.name(), self.name())
+        return self.rng.choice(["None", "True", "False"])
+
+    def expression(self):
+        parts = [self.name() if self.rng.random() < 0.5 else self.literal()]
+        for _ in range(self.rng.randrange(3)):
+            parts.append(self.rng.choice(OPS))
+            parts.append(self.name() if self.rng.random() < 0.5 else self.literal())
+        return " ".join(parts)
+
+    def statement(self, depth, budget):
+        r = self.rng.random()
+        if r < 0.15 and budget > 0:
+            self.line(depth, "if %s:" % self.expression())
+            self.body(depth + 1, budget - 1)
+            if self.rng.random() < 0.5:
+                self.line(depth, "else:")
+                self.body(depth + 1, budget - 1)
+        elif r < 0.25 and budget > 0:
+            self.line(depth, "for %s in %s:" % (self.name(), self.name()))
+            self.body(depth + 1, budget - 1)
+        elif r < 0.3 and budget > 0:
+            self.line(depth, "while %s:" % self.expression())
+            self.body(depth + 1, budget - 1)
+        elif r < 0.4:
+            # A comment is not a statement, so it never makes or opens a body
+            self.line(depth, "%s = %s" % (self.name(), self.literal()))
+            self.line(depth, "# %s %s" % (self.name(), self.name()))
+        elif r < 0.5:
+            self.line(depth, "self.%s = %s" % (self.name(), self.expression()))
+        elif r < 0.6:
+            self.line(depth, "return %s" % self.expression())
+        else:
+            self.line(depth, "%s = %s(%s)" % (self.name(), self.name(), self.expression()))
+
+    def body(self, depth, budget):
+        for _ in range(self.rng.randrange(1, 5)):
+            self.statement(depth, budget)
+
+    def params(self, first):
+        params = [first] if first else []
+        defaults = False
+        for i in range(self.rng.randrange(4)):
+            param = "%s_%d" % (self.name(), i)
+            if self.rng.random() < 0.6:
+                param += ": " + self.rng.choice(TYPES)
+            # Parameters with a default come last
+            defaults = defaults or self.rng.random() < 0.3
+            if defaults:
+                param += " = " + self.literal()
+            params.append(param)
+        # The grammar wants a named parameter before any starred one
+        if params and self.rng.random() < 0.1:
+            params.append("*args")
+        if params and self.rng.random() < 0.1:
+            params.append("**kwargs")
+        return ", ".join(params)
+
+    def method(self, depth, index):
+        decorator, first = self.rng.choice([
+            (None, "self"), (None, "self"), (None, "self"),
+            ("@property", "self"), ("@staticmethod", None),
+            ("@classmethod", "cls"), ("@abstractmethod", "self")])
+        if decorator == "@property":
+            params = "self"
+        else:
+            params = self.params(first)
+        if decorator:
+            self.line(depth, decorator)
+        name = "__init__" if index == 0 and decorator is None else self.name() + "_%d" % index
+        returns = " -> " + self.rng.choice(TYPES) if self.rng.random() < 0.5 else ""
+        self.line(depth, "def %s(%s)%s:" % (name, params, returns))
+        if self.rng.random() < 0.3:
+            self.line(depth + 1, '"""%s the %s."""' % (self.name().capitalize(), self.name()))
+        self.body(depth + 1, 2)
+        self.line(0, "")
+
+    def klass(self, index, bases):
+        parents = "(%s)" % ", ".join(bases) if bases else ""
+        self.line(0, "class Class%d%s:" % (index, parents))
+        for m in range(self.rng.randrange(1, 8)):
+            self.method(1, m)
+
+
+def generate(path, rng, classes):
+    writer = Writer(rng)
+    writer.line(0, "import os")
+    writer.line(0, "from typing import Any")
+    writer.line(0, "")
+    for c in range(classes):
+        bases = ["Class%d" % rng.randrange(c)] if c and rng.random() < 0.5 else []
+        writer.klass(c, bases)
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(writer.lines) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("out_dir")
+    parser.add_argument("--files", type=int, default=200)
+    parser.add_argument("--classes", type=int, default=10, help="classes per file")
+    parser.add_argument("--seed", type=int, default=1)
+    args = parser.parse_args()
+
+    rng = random.Random(args.seed)
+    os.makedirs(args.out_dir, exist_ok=True)
+    for i in range(args.files):
+        generate(os.path.join(args.out_dir, "module_%04d.py" % i), rng, args.classes)
+
+
+if __name__ == "__main__":
+    main()
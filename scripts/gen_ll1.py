@@ -0,0 +1,259 @@
+"""Generates the predict table of the LL(1) parser from grammar/pooLL1.y:
+
+    python3 scripts/gen_ll1.py grammar/pooLL1.y [--tags include/Token.h] [-o LL1Tables.cpp]
+
+The builds run it on every change of the grammar or of Token.h, so the
+tables are never checked in. Only the bison declarations and rules are
+read: '%token' names, which must be Tag enumerators of Token.h, and rules
+'name : symbols | ... ;' with '%empty' for the empty alternative. Code
+blocks and actions are ignored; the first rule is the start symbol.
+
+FIRST and FOLLOW sets are computed by fixed-point iteration and every
+alternative is entered in the table under the terminals that predict it.
+Two alternatives predicted by the same terminal make the grammar not
+LL(1): they are reported and nothing is written.
+"""
+import argparse
+import io
+import os
+import re
+import sys
+
+SCRIPTS_DIR = os.path.dirname(os.path.abspath(__file__))
+END = "$end"
+
+
+class Error(Exception):
+    pass
+
+
+# --- Reading the grammar ----------------------------------------------------
+
+def read_tags(path):
+    """Names of the Tag enumerators of Token.h, in order: the value of a
+    terminal in the table is its tag."""
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    match = re.search(r"enum\s+class\s+Tag\s*\{(.*?)\}", text, re.S)
+    if not match:
+        raise Error("%s: no enum class Tag" % path)
+    body = re.sub(r"//[^\n]*|/\*.*?\*/", "", match.group(1), flags=re.S)
+    return [name.strip() for name in body.split(",") if name.strip()]
+
+
+def strip_code(text):
+    """Removes comments and brace blocks (code sections and actions)."""
+    out = []
+    i = 0
+    depth = 0
+    while i < len(text):
+        if text.startswith("//", i):
+            i = text.find("\n", i) if text.find("\n", i) >= 0 else len(text)
+            continue
+        if text.startswith("/*", i):
+            end = text.find("*/", i + 2)
+            if end < 0:
+                raise Error("unterminated comment")
+            i = end + 2
+            continue
+        c = text[i]
+        if c == "{":
+            depth += 1
+        elif c == "}":
+            depth -= 1
+        elif depth == 0:
+            out.append(c)
+        i += 1
+    return "".join(out)
+
+
+def read_grammar(path):
+    with open(path, encoding="utf-8") as f:
+        text = f.read()
+    text = re.sub(r"^%\{.*?^%\}", "", text, flags=re.S | re.M)
+    sections = strip_code(text).split("%%")
+    if len(sections) < 2:
+        raise Error("%s: no rules section" % path)
+
+    tokens = []
+    for line in sections[0].split("\n"):
+        words = line.split()
+        if words and words[0] == "%token":
+            tokens += words[1:]
+
+    rules = {}  # Nonterminal -> list of alternatives, in order
+    order = []
+    for rule in sections[1].split(";"):
+        if not rule.strip():
+            continue
+        head, colon, body = rule.partition(":")
+        name = head.strip()
+        if not colon or not re.match(r"^[A-Za-z_]\w*$", name):
+            raise Error("%s: malformed rule %r" % (path, rule.strip()[:40]))
+        if name in rules:
+            raise Error("%s: %s is defined twice" % (path, name))
+        order.append(name)
+        rules[name] = [[s for s in alt.split() if s != "%empty"] for alt in body.split("|")]
+
+    for name in order:
+        for alt in rules[name]:
+            for symbol in alt:
+                if symbol not in rules and symbol not in tokens:
+                    raise Error("%s: %s uses undeclared symbol %s" % (path, name, symbol))
+    return tokens, order, rules
+
+
+# --- LL(1) analysis ---------------------------------------------------------
+
+def first_of(symbols, first, nullable):
+    """FIRST of a sequence of symbols and whether it derives the empty string."""
+    out = set()
+    for symbol in symbols:
+        if symbol not in first:  # Terminal
+            out.add(symbol)
+            return out, False
+        out |= first[symbol]
+        if symbol not in nullable:
+            return out, False
+    return out, True
+
+
+def analyze(order, rules):
+    first = {name: set() for name in order}
+    nullable = set()
+    changed = True
+    while changed:
+        changed = False
+        for name in order:
+            for alt in rules[name]:
+                symbols, empty = first_of(alt, first, nullable)
+                if not symbols <= first[name]:
+                    first[name] |= symbols
+                    changed = True
+                if empty and name not in nullable:
+                    nullable.add(name)
+                    changed = True
+
+    follow = {name: set() for name in order}
+    follow[order[0]].add(END)
+    changed = True
+    while changed:
+        changed = False
+        for name in order:
+            for alt in rules[name]:
+                for i, symbol in enumerate(alt):
+                    if symbol not in follow:
+                        continue
+                    symbols, empty = first_of(alt[i + 1:], first, nullable)
+                    if empty:
+                        symbols = symbols | follow[name]
+                    if not symbols <= follow[symbol]:
+                        follow[symbol] |= symbols
+                        changed = True
+    return first, nullable, follow
+
+
+def predict_table(order, rules):
+    """Maps (nonterminal, terminal) to the index of the alternative to expand,
+    numbering the alternatives of all rules in grammar order."""
+    first, nullable, follow = analyze(order, rules)
+    table = {}
+    conflicts = {}  # (earlier production, production) -> terminals
+    productions = []
+    for name in order:
+        for alt in rules[name]:
+            symbols, empty = first_of(alt, first, nullable)
+            if empty:
+                symbols = symbols | follow[name]
+            for terminal in sorted(symbols):
+                previous = table.setdefault((name, terminal), len(productions))
+                if previous != len(productions):
+                    conflicts.setdefault((previous, len(productions)), []).append(terminal)
+            productions.append((name, alt))
+    if conflicts:
+        raise Error("not LL(1):\n  " + "\n  ".join(
+            "%s: '%s' and '%s' on %s" % (
+                productions[a][0], " ".join(productions[a][1]) or "%empty",
+                " ".join(productions[b][1]) or "%empty", " ".join(terminals))
+            for (a, b), terminals in sorted(conflicts.items())))
+    return productions, table
+
+
+# --- Output -----------------------------------------------------------------
+
+def rows(values, per_line, width):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join("%*d" % (width, v) for v in values[i:i + per_line]) + ",")
+    return lines
+
+
+def generate(path, tags_path, out):
+    tokens, order, rules = read_grammar(path)
+    tags = read_tags(tags_path)
+    missing = [t for t in tokens if t not in tags]
+    if missing:
+        raise Error("%s: tokens that are not in Tag: %s" % (path, " ".join(missing)))
+    productions, table = predict_table(order, rules)
+
+    # Terminals are numbered by tag, END follows them, nonterminals come next
+    terminal = {name: i for i, name in enumerate(tags)}
+    terminal[END] = len(tags)
+    symbol = dict(terminal)
+    for i, name in enumerate(order):
+        symbol[name] = len(tags) + 1 + i
+
+    lines = [
+        "// Generated by scripts/gen_ll1.py from %s, do not edit" % path.replace("\\", "/"),
+        "// %d nonterminals, %d productions" % (len(order), len(productions)),
+        '#include "LL1Tables.h"',
+        "",
+        "namespace ll1 {",
+        "",
+        'static_assert(TAG_COUNT == %d, "Tag changed since the table was generated");' % len(tags),
+        "",
+        "const int START = %d;  // %s" % (symbol[order[0]], order[0]),
+        "",
+        "const int16_t PREDICT[] = {",
+    ]
+    for name in order:
+        lines.append("    // %s" % name)
+        lines += rows([table.get((name, t), -1) for t in tags + [END]], 16, 3)
+    lines += ["};", "", "// Right-hand sides in reverse, ready to be pushed", "const int16_t RHS[] = {"]
+    begin = [0]
+    for number, (name, alt) in enumerate(productions):
+        values = [symbol[s] for s in reversed(alt)]
+        if values:
+            lines.append("    %s  // %d: %s -> %s" % (
+                " ".join("%d," % v for v in values), number, name, " ".join(alt)))
+        begin.append(begin[-1] + len(values))
+    lines += ["};", "", "const uint16_t RHS_BEGIN[] = {"]
+    lines += rows(begin, 16, 4)
+    lines += ["};", "", "const char* const NONTERMINAL_NAMES[] = {"]
+    lines += ['    "%s",' % name for name in order]
+    lines += ["};", "", "}  // namespace ll1", ""]
+    out.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("grammar")
+    parser.add_argument("--tags", default=os.path.join(SCRIPTS_DIR, "..", "include", "Token.h"),
+                        help="header with the Tag enum (default: include/Token.h)")
+    parser.add_argument("-o", "--output", help="output file (default: stdout)")
+    args = parser.parse_args()
+    try:
+        # Written in one go, so a failed run never leaves a partial file
+        buffer = io.StringIO()
+        generate(args.grammar, args.tags, buffer)
+        if args.output:
+            with open(args.output, "w", encoding="utf-8") as f:
+                f.write(buffer.getvalue())
+        else:
+            sys.stdout.write(buffer.getvalue())
+    except (Error, OSError) as e:
+        sys.exit("gen_ll1.py: %s" % e)
+
+
+if __name__ == "__main__":
+    main()
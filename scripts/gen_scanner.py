@@ -0,0 +1,505 @@
+"""Generates the tables of the lexer's DFA scanner from grammar/lexer.l:
+
+    python3 scripts/gen_scanner.py grammar/lexer.l [-o ScannerTables.cpp]
+
+The builds run it on every change of lexer.l, so the tables are never
+checked in. Only the part of flex the grammar uses is understood: named
+definitions, quoted strings, character classes, '.', escapes, grouping,
+'|', '*', '+' and '?'. Actions are either empty (the match is skipped),
+'return TAG;' with a Tag name from Token.h, or 'yyerror("message");'.
+
+The rules are compiled to one NFA (Thompson's construction), made
+deterministic by subset construction and minimized by partition
+refinement. Bytes that move every state the same way share a class, so the
+transition table has one column per class instead of 256. Like flex, the
+scanner takes the longest match and, between matches of the same length,
+the rule written first.
+"""
+import argparse
+import re
+import sys
+
+ESCAPES = {"n": ord("\n"), "t": ord("\t"), "r": ord("\r"), "f": ord("\f"),
+           "v": ord("\v"), "a": 7, "b": 8, "0": 0}
+ALL_BYTES = frozenset(range(256))
+
+
+class Error(Exception):
+    pass
+
+
+# --- Reading lexer.l --------------------------------------------------------
+
+def split_pattern(line):
+    """Splits a rule line into its pattern and its action: the pattern ends at
+    the first blank outside quotes and brackets."""
+    i = 0
+    quoted = False
+    bracket = False
+    while i < len(line):
+        c = line[i]
+        if c == "\\":
+            i += 2
+            continue
+        if quoted:
+            quoted = c != '"'
+        elif bracket:
+            bracket = c != "]"
+        elif c == '"':
+            quoted = True
+        elif c == "[":
+            bracket = True
+            # A ']' right after '[' or '[^' is a member, not the end
+            if line[i + 1:i + 2] == "^":
+                i += 1
+            if line[i + 1:i + 2] == "]":
+                i += 1
+        elif c in " \t":
+            return line[:i], line[i:].strip()
+        i += 1
+    return line, ""
+
+
+def read_grammar(path):
+    with open(path, encoding="utf-8") as f:
+        lines = f.read().split("\n")
+
+    definitions = {}
+    rules = []
+    section = 0
+    in_code = False
+    for number, line in enumerate(lines, 1):
+        if line.startswith("%{"):
+            in_code = True
+            continue
+        if line.startswith("%}"):
+            in_code = False
+            continue
+        if in_code:
+            continue
+        if line.startswith("%%"):
+            section += 1
+            continue
+        if section >= 2:
+            break
+        # Blank lines and indented lines (comments, code) are not rules
+        if not line.strip() or line[0] in " \t":
+            continue
+        if section == 0:
+            name, pattern = line.split(None, 1)
+            definitions[name] = pattern.strip()
+        else:
+            pattern, action = split_pattern(line)
+            rules.append((number, pattern, parse_action(action, number)))
+    if not rules:
+        raise Error("%s: no rules" % path)
+    return definitions, rules
+
+
+def parse_action(action, number):
+    action = re.sub(r"/\*.*?\*/", "", action).strip()
+    if action in ("", ";"):
+        return ("Skip", None, None)
+    m = re.fullmatch(r"\{\s*return\s+(\w+)\s*;\s*\}", action)
+    if m:
+        tag = m.group(1)
+        return ("Newline" if tag == "NEWLINE" else "Token", tag, None)
+    m = re.fullmatch(r'\{\s*yyerror\("([^"\\]*)"\)\s*;\s*\}', action)
+    if m:
+        return ("Error", None, m.group(1))
+    raise Error("line %d: unsupported action %r" % (number, action))
+
+
+# --- Patterns to NFA --------------------------------------------------------
+
+class Nfa:
+    def __init__(self):
+        self.edges = []    # Per state: list of (byte set, target)
+        self.epsilon = []  # Per state: list of targets
+        self.accept = {}   # State -> rule index
+
+    def state(self):
+        self.edges.append([])
+        self.epsilon.append([])
+        return len(self.edges) - 1
+
+
+class PatternParser:
+    """Recursive descent over one pattern, building an NFA fragment
+    (start, end) for every sub-pattern."""
+
+    def __init__(self, nfa, text, definitions, number):
+        self.nfa = nfa
+        self.text = text
+        self.definitions = definitions
+        self.number = number
+        self.i = 0
+
+    def error(self, message):
+        raise Error("line %d: %s in pattern %r" % (self.number, message, self.text))
+
+    def peek(self):
+        return self.text[self.i] if self.i < len(self.text) else None
+
+    def parse(self):
+        fragment = self.alternation()
+        if self.i != len(self.text):
+            self.error("unexpected %r" % self.peek())
+        return fragment
+
+    def alternation(self):
+        fragment = self.sequence()
+        while self.peek() == "|":
+            self.i += 1
+            other = self.sequence()
+            start, end = self.nfa.state(), self.nfa.state()
+            self.nfa.epsilon[start] += [fragment[0], other[0]]
+            self.nfa.epsilon[fragment[1]].append(end)
+            self.nfa.epsilon[other[1]].append(end)
+            fragment = (start, end)
+        return fragment
+
+    def sequence(self):
+        start = end = self.nfa.state()
+        while self.peek() not in (None, "|", ")"):
+            piece = self.repetition()
+            self.nfa.epsilon[end].append(piece[0])
+            end = piece[1]
+        return (start, end)
+
+    def repetition(self):
+        fragment = self.atom()
+        while self.peek() in ("*", "+", "?"):
+            op = self.peek()
+            self.i += 1
+            start, end = self.nfa.state(), self.nfa.state()
+            self.nfa.epsilon[start].append(fragment[0])
+            self.nfa.epsilon[fragment[1]].append(end)
+            if op in ("*", "?"):
+                self.nfa.epsilon[start].append(end)
+            if op in ("*", "+"):
+                self.nfa.epsilon[fragment[1]].append(fragment[0])
+            fragment = (start, end)
+        return fragment
+
+    def bytes_fragment(self, byte_set):
+        start, end = self.nfa.state(), self.nfa.state()
+        self.nfa.edges[start].append((frozenset(byte_set), end))
+        return (start, end)
+
+    def escape(self):
+        # After the backslash
+        c = self.peek()
+        if c is None:
+            self.error("dangling backslash")
+        if c == "x":
+            digits = self.text[self.i + 1:self.i + 3]
+            if not re.fullmatch(r"[0-9a-fA-F]{2}", digits):
+                self.error("bad \\x escape")
+            self.i += 3
+            return int(digits, 16)
+        self.i += 1
+        return ESCAPES.get(c, ord(c))
+
+    def atom(self):
+        c = self.peek()
+        if c is None:
+            self.error("missing operand")
+        if c == "(":
+            self.i += 1
+            fragment = self.alternation()
+            if self.peek() != ")":
+                self.error("missing ')'")
+            self.i += 1
+            return fragment
+        if c == "[":
+            return self.bytes_fragment(self.char_class())
+        if c == ".":
+            self.i += 1
+            return self.bytes_fragment(ALL_BYTES - {ord("\n")})
+        if c == '"':
+            return self.quoted()
+        if c == "{":
+            close = self.text.find("}", self.i)
+            name = self.text[self.i + 1:close]
+            if close < 0 or name not in self.definitions:
+                self.error("unknown definition {%s}" % name)
+            self.i = close + 1
+            return PatternParser(self.nfa, self.definitions[name], self.definitions, self.number).parse()
+        if c in "*+?|)":
+            self.error("unexpected %r" % c)
+        self.i += 1
+        if c == "\\":
+            return self.bytes_fragment({self.escape()})
+        return self.literal(c.encode("utf-8"))
+
+    def literal(self, data):
+        start = end = self.nfa.state()
+        for byte in data:
+            target = self.nfa.state()
+            self.nfa.edges[end].append((frozenset({byte}), target))
+            end = target
+        return (start, end)
+
+    def quoted(self):
+        self.i += 1
+        data = bytearray()
+        while self.peek() != '"':
+            if self.peek() is None:
+                self.error("unterminated string")
+            c = self.peek()
+            self.i += 1
+            if c == "\\":
+                data.append(self.escape())
+            else:
+                data += c.encode("utf-8")
+        self.i += 1
+        return self.literal(bytes(data))
+
+    def char_class(self):
+        self.i += 1
+        negate = self.peek() == "^"
+        if negate:
+            self.i += 1
+        members = set()
+        first = True
+        while first or self.peek() != "]":
+            first = False
+            if self.peek() is None:
+                self.error("unterminated character class")
+            low = self.class_char()
+            if self.peek() == "-" and self.text[self.i + 1:self.i + 2] not in ("]", ""):
+                self.i += 1
+                high = self.class_char()
+                if high < low:
+                    self.error("empty range")
+                members.update(range(low, high + 1))
+            else:
+                members.add(low)
+        self.i += 1
+        return ALL_BYTES - members if negate else members
+
+    def class_char(self):
+        c = self.peek()
+        self.i += 1
+        if c == "\\":
+            return self.escape()
+        if ord(c) > 127:
+            self.error("non-ASCII character in a class")
+        return ord(c)
+
+
+def literal_text(pattern):
+    """The text a pattern matches if it is a single quoted string, else None"""
+    m = re.fullmatch(r'"([^"\\]*)"', pattern)
+    return m.group(1) if m else None
+
+
+def build_nfa(definitions, rules):
+    nfa = Nfa()
+    start = nfa.state()
+    for index, (number, pattern, _) in enumerate(rules):
+        fragment = PatternParser(nfa, pattern, definitions, number).parse()
+        nfa.epsilon[start].append(fragment[0])
+        nfa.accept[fragment[1]] = index
+    return nfa, start
+
+
+# --- DFA --------------------------------------------------------------------
+
+def closure(nfa, states):
+    stack = list(states)
+    seen = set(states)
+    while stack:
+        for target in nfa.epsilon[stack.pop()]:
+            if target not in seen:
+                seen.add(target)
+                stack.append(target)
+    return frozenset(seen)
+
+
+def subset_construction(nfa, start):
+    """Returns (transitions, accept): transitions[s] maps byte -> state,
+    accept[s] is the first rule accepted in s or -1. State 0 is the start."""
+    initial = closure(nfa, {start})
+    ids = {initial: 0}
+    order = [initial]
+    transitions = []
+    accept = []
+    while len(transitions) < len(order):
+        current = order[len(transitions)]
+        rules = [nfa.accept[s] for s in current if s in nfa.accept]
+        accept.append(min(rules) if rules else -1)
+        moves = {}
+        for s in current:
+            for byte_set, target in nfa.edges[s]:
+                for byte in byte_set:
+                    moves.setdefault(byte, set()).add(target)
+        row = {}
+        for byte, targets in moves.items():
+            target = closure(nfa, targets)
+            if target not in ids:
+                ids[target] = len(order)
+                order.append(target)
+            row[byte] = ids[target]
+        transitions.append(row)
+    return transitions, accept
+
+
+def minimize(transitions, accept):
+    """Moore's partition refinement: states start grouped by the rule they
+    accept and are split until every group moves alike on every byte."""
+    count = len(transitions)
+    group = list(accept)
+    while True:
+        signatures = {}
+        new_group = []
+        for s in range(count):
+            row = transitions[s]
+            signature = (group[s], tuple(group[row[b]] if b in row else None for b in range(256)))
+            new_group.append(signatures.setdefault(signature, len(signatures)))
+        if len(signatures) == len(set(group)):
+            break
+        group = new_group
+    # Renumber so that the start state stays first
+    numbering = {}
+    for s in range(count):
+        numbering.setdefault(group[s], len(numbering))
+    size = len(numbering)
+    min_transitions = [None] * size
+    min_accept = [None] * size
+    for s in range(count):
+        g = numbering[group[s]]
+        if min_transitions[g] is None:
+            min_transitions[g] = {b: numbering[group[t]] for b, t in transitions[s].items()}
+            min_accept[g] = accept[s]
+    return min_transitions, min_accept
+
+
+def byte_classes(transitions):
+    """Groups the bytes whose column is the same in every state"""
+    columns = {}
+    classes = []
+    for byte in range(256):
+        column = tuple(row.get(byte) for row in transitions)
+        classes.append(columns.setdefault(column, len(columns)))
+    return classes, len(columns)
+
+
+# --- Output -----------------------------------------------------------------
+
+def c_string(text):
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def rows(values, per_line, width):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join("%*d" % (width, v) for v in values[i:i + per_line]) + ",")
+    return lines
+
+
+MATCH = """int match(const char* begin, const char* end, const char*& match_end) {
+    int state = START;
+    int rule = -1;
+    match_end = begin;
+    for (const char* p = begin; p < end; ) {
+        state = TRANSITIONS[state][BYTE_CLASS[static_cast<unsigned char>(*p)]];
+        if (state == DEAD) {
+            break;
+        }
+        p++;
+        if (ACCEPT[state] >= 0) {
+            rule = ACCEPT[state];
+            match_end = p;
+        }
+    }
+    return rule;
+}
+"""
+
+
+def generate(path, out):
+    definitions, rules = read_grammar(path)
+    nfa, start = build_nfa(definitions, rules)
+    transitions, accept = minimize(*subset_construction(nfa, start))
+    for index, (number, pattern, _) in enumerate(rules):
+        if index not in accept:
+            print("warning: line %d: rule %s never matches" % (number, pattern), file=sys.stderr)
+
+    # Table state 0 is the dead state, DFA state s is table state s + 1
+    classes, class_count = byte_classes(transitions)
+    representative = {}
+    for byte, c in enumerate(classes):
+        representative.setdefault(c, byte)
+    table = [0] * class_count
+    for row in transitions:
+        for c in range(class_count):
+            target = row.get(representative[c])
+            table.append(0 if target is None else target + 1)
+    state_count = len(transitions) + 1
+    if state_count > 0xFFFF:
+        raise Error("too many states: %d" % state_count)
+
+    # The state type and the row length are constants here, so the match
+    # loop below compiles to two loads per byte
+    state_type = "uint8_t" if state_count <= 0x100 else "uint16_t"
+    lines = [
+        "// Generated by scripts/gen_scanner.py from %s, do not edit" % path.replace("\\", "/"),
+        "// %d rules, %d states, %d byte classes" % (len(rules), state_count, class_count),
+        '#include "ScannerTables.h"',
+        "",
+        "namespace scanner {",
+        "",
+        "const int RULE_COUNT = %d;" % len(rules),
+        "",
+        "namespace {",
+        "",
+        "constexpr int STATE_COUNT = %d;" % state_count,
+        "constexpr int CLASS_COUNT = %d;" % class_count,
+        "constexpr int DEAD = 0;",
+        "constexpr int START = 1;",
+        "",
+        "const uint8_t BYTE_CLASS[256] = {",
+    ]
+    lines += rows(classes, 16, 3)
+    lines += ["};", "", "const %s TRANSITIONS[STATE_COUNT][CLASS_COUNT] = {" % state_type]
+    for s in range(state_count):
+        lines.append("    {")
+        lines += ["    " + line for line in rows(table[s * class_count:(s + 1) * class_count], 16, 3)]
+        lines.append("    },")
+    lines += ["};", "", "// Rule accepted in each state, -1 if none", "const int16_t ACCEPT[STATE_COUNT] = {"]
+    lines += rows([-1] + accept, 16, 3)
+    lines += ["};", "", "}  // namespace", "", "const Rule RULES[] = {"]
+    for number, pattern, (action, tag, message) in rules:
+        text = message if action == "Error" else literal_text(pattern)
+        lines.append("    {Action::%s, %s, %s},  // lexer.l:%d" % (
+            action,
+            "static_cast<int>(Tag::%s)" % tag if tag else "-1",
+            c_string(text) if text is not None else "nullptr",
+            number))
+    lines += ["};", "", MATCH, "}  // namespace scanner", ""]
+    out.write("\n".join(lines))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("grammar")
+    parser.add_argument("-o", "--output", help="output file (default: stdout)")
+    args = parser.parse_args()
+    try:
+        if args.output:
+            # Written in one go, so a failed run never leaves a partial file
+            import io
+            buffer = io.StringIO()
+            generate(args.grammar, buffer)
+            with open(args.output, "w", encoding="utf-8") as f:
+                f.write(buffer.getvalue())
+        else:
+            generate(args.grammar, sys.stdout)
+    except (Error, OSError) as e:
+        sys.exit("gen_scanner.py: %s" % e)
+
+
+if __name__ == "__main__":
+    main()
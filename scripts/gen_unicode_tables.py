@@ -0,0 +1,59 @@
+"""Generates src/UnicodeTables.cpp, the XID_Start and XID_Continue range
+tables used by the lexer for PEP 3131 identifiers.
+
+The tables come from the Unicode database of the Python running this
+script, so the lexer accepts the same identifiers as that Python:
+
+    python3 scripts/gen_unicode_tables.py > src/UnicodeTables.cpp
+"""
+import sys
+import unicodedata
+
+
+def ranges(predicate):
+    """Sorted, non-overlapping [first, last] ranges of the code points above
+    ASCII (the lexer handles ASCII with its own table) matching predicate."""
+    result = []
+    start = None
+    for cp in range(0x80, sys.maxunicode + 2):
+        inside = cp <= sys.maxunicode and predicate(chr(cp))
+        if inside and start is None:
+            start = cp
+        elif not inside and start is not None:
+            result.append((start, cp - 1))
+            start = None
+    return result
+
+
+def is_xid_start(c):
+    # str.isidentifier checks XID_Start for the first character
+    return c.isidentifier()
+
+
+def is_xid_continue(c):
+    # and XID_Continue for the others
+    return ("a" + c).isidentifier()
+
+
+def table(name, items):
+    lines = ["const UnicodeRange %s[] = {" % name]
+    for i in range(0, len(items), 4):
+        row = ", ".join("{0x%05X, 0x%05X}" % r for r in items[i:i + 4])
+        lines.append("    " + row + ",")
+    lines.append("};")
+    lines.append("const size_t %s_SIZE = sizeof(%s) / sizeof(%s[0]);" % (name, name, name))
+    return "\n".join(lines)
+
+
+def main():
+    print("// Generated by scripts/gen_unicode_tables.py from Unicode %s, do not edit"
+          % unicodedata.unidata_version)
+    print('#include "Unicode.h"')
+    print()
+    print(table("XID_START", ranges(is_xid_start)))
+    print()
+    print(table("XID_CONTINUE", ranges(is_xid_continue)))
+
+
+if __name__ == "__main__":
+    main()
@@ -5,7 +5,10 @@ from pathlib import Path
 import ast
 
 def test_code_snippet(code_snippet, executable_path):
-    """Test a code snippet using main.exe."""
+    """Test a code snippet using main.exe.
+
+    Python's ast module stays the reference for what is valid Python;
+    --bodies makes the parser check the method bodies of what it accepts."""
     temp_file = None
     try:
         temp_file = "temp_test.py"
@@ -14,7 +17,7 @@ def test_code_snippet(code_snippet, executable_path):
         with open(temp_file, "w", encoding='utf-8') as f:
             f.write(unparsed_code)
         
-        result = subprocess.run([executable_path, temp_file], 
+        result = subprocess.run([executable_path, "--bodies", temp_file], 
                               capture_output=True, 
                               text=True,
                               encoding='utf-8',
@@ -0,0 +1,88 @@
+#include "Ast.h"
+#include "Num.h"
+#include "Str.h"
+#include "TokenStream.h"
+#include "Word.h"
+
+const char* astKindName(AstKind kind) {
+    static const char* const names[] = {
+        "Body", "If", "For", "While", "Try", "Handler", "With", "WithItem", "Return", "Pass",
+        "Break", "Continue", "Raise", "Assert", "Delete", "Global", "Nonlocal", "Import",
+        "ImportFrom", "Alias", "Assign", "AugAssign", "AnnAssign", "Expression", "FunctionDef",
+        "ClassDef", "Parameter",
+        "Name", "Number", "String", "Constant", "Ellipsis", "Unary", "Binary", "BoolOp", "Compare",
+        "IfExp", "Lambda", "Await", "Yield", "Call", "Keyword", "Starred", "Attribute", "Subscript",
+        "Slice", "Tuple", "List", "Dict", "Set", "ListComp", "SetComp", "DictComp", "Generator",
+        "ComprehensionFor", "Empty"
+    };
+    static_assert(sizeof(names) / sizeof(names[0]) == static_cast<size_t>(AstKind::Empty) + 1,
+                  "names must list every AstKind");
+    return names[static_cast<int>(kind)];
+}
+
+const char* astOpName(AstOp op) {
+    static const char* const names[] = {
+        "", "+", "-", "*", "/", "//", "%", "**", "<<", ">>",
+        "+", "-", "not",
+        "and", "or",
+        "==", "!=", "<", "<=", ">", ">=", "in", "not in", "is", "is not",
+        "*", "**",
+        "from"
+    };
+    static_assert(sizeof(names) / sizeof(names[0]) == static_cast<size_t>(AstOp::From) + 1,
+                  "names must list every AstOp");
+    return names[static_cast<int>(op)];
+}
+
+static void dump(const std::vector<AstNode>& nodes, int32_t index, const TokenStream& stream, std::string& out) {
+    const AstNode& node = nodes[index];
+    Token* token = node.token < stream.size() ? stream.at(node.token) : nullptr;
+    out += '(';
+    out += astKindName(node.kind);
+    if (node.op != AstOp::None) {
+        out += ' ';
+        out += astOpName(node.op);
+    }
+    switch (node.kind) {
+        case AstKind::Name:
+        case AstKind::Attribute:
+        case AstKind::Keyword:
+        case AstKind::Constant:
+        case AstKind::FunctionDef:
+        case AstKind::ClassDef:
+        case AstKind::Parameter:
+            if (Word* word = dynamic_cast<Word*>(token)) {
+                out += ' ';
+                out += word->lexeme;
+            }
+            break;
+        case AstKind::Number:
+            if (Num* num = dynamic_cast<Num*>(token)) {
+                out += ' ';
+                out += num->toString();
+            }
+            break;
+        case AstKind::String:
+            if (Str* str = dynamic_cast<Str*>(token)) {
+                out += " \"";
+                out += str->raw;
+                out += '"';
+            }
+            break;
+        default:
+            break;
+    }
+    for (int32_t child = node.first_child; child >= 0; child = nodes[child].next_sibling) {
+        out += ' ';
+        dump(nodes, child, stream, out);
+    }
+    out += ')';
+}
+
+std::string dumpAst(const std::vector<AstNode>& nodes, int32_t root, const TokenStream& stream) {
+    std::string out;
+    if (root >= 0) {
+        dump(nodes, root, stream, out);
+    }
+    return out;
+}
@@ -0,0 +1,229 @@
+#include "BatchResults.h"
+#include "Dataset.h"
+#include "Emitter.h"
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <stdexcept>
+
+namespace {
+
+// FNV-1a: unlike std::hash, the same on every platform and in every run
+uint64_t stableHash(std::string_view s) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char c : s) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+std::string describe(const Shard& shard) {
+    return std::to_string(shard.index) + "/" + std::to_string(shard.count);
+}
+
+void appendHeader(std::string& out, const Shard& shard, size_t inputs) {
+    out += "{\"shard\":";
+    out += std::to_string(shard.index);
+    out += ",\"shards\":";
+    out += std::to_string(shard.count);
+    out += ",\"inputs\":";
+    out += std::to_string(inputs);
+    out += "}\n";
+}
+
+void appendRecord(std::string& out, const BatchResult& result) {
+    out += "{\"name\":";
+    appendJsonString(out, result.name);
+    out += result.accepted ? ",\"accepted\":true,\"ns\":" : ",\"accepted\":false,\"ns\":";
+    out += std::to_string(result.ns);
+    out += ",\"error\":";
+    appendJsonString(out, result.error);
+    out += "}\n";
+}
+
+// Output written in large blocks
+class ResultsWriter {
+public:
+    explicit ResultsWriter(const std::string& path) : path(path), out(path, std::ios::binary) {
+        if (!this->out) {
+            throw std::runtime_error("Could not write file " + path);
+        }
+        this->buffer.reserve(1 << 20);
+    }
+
+    std::string& text() { return this->buffer; }
+
+    void flush(bool always = false) {
+        if (always || this->buffer.size() > (1 << 20) - 4096) {
+            this->out.write(this->buffer.data(), static_cast<std::streamsize>(this->buffer.size()));
+            this->buffer.clear();
+            if (!this->out) {
+                throw std::runtime_error("Could not write file " + this->path);
+            }
+        }
+    }
+
+private:
+    std::string path;
+    std::ofstream out;
+    std::string buffer;
+};
+
+// A results file being merged, positioned at one of its records
+struct ResultsFile {
+    std::string path;
+    std::ifstream in;
+    Shard shard;
+    int64_t inputs = 0;
+    int64_t read = 0;
+    std::string line;
+    BatchResult current;
+
+    explicit ResultsFile(const std::string& path) : path(path), in(path, std::ios::binary) {
+        if (!this->in.is_open()) {
+            throw std::runtime_error("Cannot open results file: " + path);
+        }
+        int64_t index;
+        int64_t count;
+        if (!std::getline(this->in, this->line) || !jsonIntField(this->line, "shard", index) ||
+            !jsonIntField(this->line, "shards", count) || !jsonIntField(this->line, "inputs", this->inputs) ||
+            count < 1 || index < 0 || index >= count || this->inputs < 0) {
+            throw std::runtime_error("Not a results file: " + path);
+        }
+        this->shard.index = static_cast<uint32_t>(index);
+        this->shard.count = static_cast<uint32_t>(count);
+    }
+
+    // Moves to the next record; false after the last one
+    bool next() {
+        if (!std::getline(this->in, this->line)) {
+            if (this->read != this->inputs) {
+                throw std::runtime_error("Truncated results file: " + this->path);
+            }
+            return false;
+        }
+        std::string previous = std::move(this->current.name);
+        if (!jsonStringField(this->line, "name", this->current.name) ||
+            !jsonBoolField(this->line, "accepted", this->current.accepted) ||
+            !jsonIntField(this->line, "ns", this->current.ns) ||
+            !jsonStringField(this->line, "error", this->current.error) || this->read == this->inputs) {
+            // Line numbers count the header
+            throw std::runtime_error("Invalid record in results file: " + this->path + ":" +
+                                     std::to_string(this->read + 2));
+        }
+        this->read++;
+        if (this->read > 1 && !(previous < this->current.name)) {
+            throw std::runtime_error("Unsorted results file: " + this->path);
+        }
+        if (!this->shard.owns(this->current.name)) {
+            throw std::runtime_error("Input " + this->current.name + " of " + this->path + " is not in shard " +
+                                     describe(this->shard));
+        }
+        return true;
+    }
+};
+
+}
+
+Shard Shard::parse(const std::string& text) {
+    size_t slash = text.find('/');
+    // Up to 9 digits on each side, so the numbers fit
+    bool valid = slash != std::string::npos && slash > 0 && slash <= 9 && text.size() - slash - 1 >= 1 &&
+                 text.size() - slash - 1 <= 9 && text.find_first_not_of("0123456789/") == std::string::npos &&
+                 text.find('/', slash + 1) == std::string::npos;
+    Shard shard;
+    if (valid) {
+        shard.index = static_cast<uint32_t>(std::stoul(text.substr(0, slash)));
+        shard.count = static_cast<uint32_t>(std::stoul(text.substr(slash + 1)));
+    }
+    if (!valid || shard.count == 0 || shard.index >= shard.count) {
+        throw std::runtime_error("Invalid shard, expected i/N with 0 <= i < N: " + text);
+    }
+    return shard;
+}
+
+bool Shard::owns(std::string_view name) const {
+    return stableHash(name) % this->count == this->index;
+}
+
+void writeResults(const std::string& path, const Shard& shard, std::vector<BatchResult> results) {
+    std::sort(results.begin(), results.end(),
+              [](const BatchResult& a, const BatchResult& b) { return a.name < b.name; });
+    ResultsWriter writer(path);
+    appendHeader(writer.text(), shard, results.size());
+    for (const BatchResult& result : results) {
+        appendRecord(writer.text(), result);
+        writer.flush();
+    }
+    writer.flush(true);
+}
+
+MergeSummary mergeResults(const std::vector<std::string>& paths, const std::string& output) {
+    std::vector<std::unique_ptr<ResultsFile>> files;
+    size_t inputs = 0;
+    for (const std::string& path : paths) {
+        files.push_back(std::make_unique<ResultsFile>(path));
+        inputs += static_cast<size_t>(files.back()->inputs);
+    }
+    if (files.empty()) {
+        throw std::runtime_error("No results files to merge");
+    }
+    uint32_t count = files[0]->shard.count;
+    for (const auto& file : files) {
+        if (file->shard.count != count) {
+            throw std::runtime_error("Results of different runs: " + files[0]->path + " has " +
+                                     std::to_string(count) + " shards, " + file->path + " has " +
+                                     std::to_string(file->shard.count));
+        }
+    }
+    if (files.size() < count) {
+        throw std::runtime_error("Missing shards: " + std::to_string(files.size()) + " results files of " +
+                                 std::to_string(count));
+    }
+    std::vector<const ResultsFile*> by_shard(count, nullptr);
+    for (const auto& file : files) {
+        const ResultsFile*& slot = by_shard[file->shard.index];
+        if (slot) {
+            throw std::runtime_error("Shard " + describe(file->shard) + " given twice: " + slot->path + " and " +
+                                     file->path);
+        }
+        slot = file.get();
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (!by_shard[i]) {
+            throw std::runtime_error("Missing shard " + std::to_string(i) + "/" + std::to_string(count));
+        }
+    }
+
+    // Files by their current name, smallest first
+    auto later = [&](size_t a, size_t b) { return files[a]->current.name > files[b]->current.name; };
+    std::priority_queue<size_t, std::vector<size_t>, decltype(later)> heads(later);
+    for (size_t f = 0; f < files.size(); f++) {
+        if (files[f]->next()) {
+            heads.push(f);
+        }
+    }
+
+    MergeSummary summary;
+    summary.shards = count;
+    ResultsWriter writer(output);
+    appendHeader(writer.text(), Shard(), inputs);
+    // Each name belongs to one shard, so the files never share one
+    while (!heads.empty()) {
+        size_t f = heads.top();
+        heads.pop();
+        ResultsFile& file = *files[f];
+        appendRecord(writer.text(), file.current);
+        writer.flush();
+        summary.inputs++;
+        summary.accepted += file.current.accepted;
+        if (file.next()) {
+            heads.push(f);
+        }
+    }
+    writer.flush(true);
+    return summary;
+}
@@ -0,0 +1,549 @@
+#include "ClassIndex.h"
+#include "Lexer.h"
+#include "Linearization.h"
+#include "RecursiveDescendant.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+const uint32_t INDEX_VERSION = 2;
+
+// Deduplicated string pool used while writing an index
+class StringPool {
+public:
+    IndexString intern(const std::string& s) {
+        auto it = this->offsets.find(s);
+        if (it == this->offsets.end()) {
+            it = this->offsets.emplace(s, static_cast<uint32_t>(this->bytes.size())).first;
+            this->bytes += s;
+        }
+        return {it->second, static_cast<uint32_t>(s.size())};
+    }
+
+    const std::string& data() const { return this->bytes; }
+
+private:
+    std::unordered_map<std::string, uint32_t> offsets;
+    std::string bytes;
+};
+
+template <typename T>
+void writeArray(std::ofstream& out, const std::vector<T>& items) {
+    out.write(reinterpret_cast<const char*>(items.data()),
+              static_cast<std::streamsize>(items.size() * sizeof(T)));
+}
+
+template <typename T>
+const T* section(const char*& cursor, uint32_t count, const char* end) {
+    const T* items = reinterpret_cast<const T*>(cursor);
+    if (static_cast<size_t>(end - cursor) / sizeof(T) < count) {
+        throw std::runtime_error("Truncated class index");
+    }
+    cursor += count * sizeof(T);
+    return items;
+}
+
+}
+
+void ClassIndexBuilder::add(const std::string& file, const Outline& outline) {
+    uint32_t id = static_cast<uint32_t>(this->files.size());
+    this->files.push_back(file);
+    for (const ClassInfo& info : outline.classes) {
+        this->classes.push_back({id, info});
+        adoptTypes(this->classes.back().info.methods, this->types);
+    }
+}
+
+size_t ClassIndexBuilder::addFiles(const std::vector<std::string>& paths, unsigned threads, FileLoader::Backend io) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(1, paths.size())));
+
+    std::vector<Outline> outlines(paths.size());
+    std::atomic<size_t> failed(0);
+    FileLoader loader(paths, io);
+
+    // Each worker reuses one lexer, stream and parser for all its files,
+    // taking whichever file is read first
+    auto work = [&]() {
+        Lexer lexer;
+        TokenStream stream;
+        RecursiveDescendant parser(nullptr);
+        FileLoader::File file;
+        while (loader.next(file)) {
+            if (!file.error.empty()) {
+                failed++;
+                continue;
+            }
+            bool parsed = false;
+            try {
+                lexer.resetBuffer(std::move(file.contents));
+                lexer.generateStream(stream);
+                parser.reset(&stream);
+                parsed = true;
+                parser.parse();
+            } catch (const std::runtime_error&) {
+                failed++;
+            }
+            // A file that failed to read or lex has no outline
+            if (parsed) {
+                outlines[file.index] = parser.outline();
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; t++) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (size_t i = 0; i < paths.size(); i++) {
+        add(paths[i], outlines[i]);
+    }
+    return failed;
+}
+
+void ClassIndexBuilder::write(const std::string& path) const {
+    // Sort by name so lookups are binary searches
+    std::vector<uint32_t> order(this->classes.size());
+    for (uint32_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return this->classes[a].info.name < this->classes[b].info.name;
+    });
+
+    StringPool pool;
+    std::vector<IndexedClass> records(order.size());
+    std::vector<IndexString> file_names;
+    std::vector<IndexString> parents;
+    std::vector<IndexedMethod> methods;
+    std::vector<const MethodInfo*> infos;  // Of each method record
+    std::vector<IndexedParent> by_parent;
+    for (const std::string& file : this->files) {
+        file_names.push_back(pool.intern(file));
+    }
+
+    for (size_t i = 0; i < order.size(); i++) {
+        const Entry& entry = this->classes[order[i]];
+        IndexedClass& record = records[i];
+        record.name = pool.intern(entry.info.name);
+        record.file = entry.file;
+        record.first_parent = static_cast<uint32_t>(parents.size());
+        record.parent_count = static_cast<uint32_t>(entry.info.parents.size());
+        for (const std::string& parent : entry.info.parents) {
+            parents.push_back(pool.intern(parent));
+            by_parent.push_back({parents.back(), static_cast<uint32_t>(i)});
+        }
+        record.first_method = static_cast<uint32_t>(methods.size());
+        record.method_count = static_cast<uint32_t>(entry.info.methods.size());
+        for (const MethodInfo& method : entry.info.methods) {
+            methods.push_back({pool.intern(method.name), method.decorators,
+                               static_cast<uint32_t>(method.params.size()), static_cast<uint32_t>(i),
+                               pool.intern(method.params.empty() ? std::string() : method.params[0].name),
+                               pool.intern(method.return_type ? method.return_type->text : std::string())});
+            infos.push_back(&method);
+        }
+    }
+
+    // Secondary indexes: method ids sorted by a key, ids in order among
+    // equal keys (stable sort of ids that start in order)
+    auto sortedBy = [&](auto key) {
+        std::vector<uint32_t> ids(methods.size());
+        for (uint32_t i = 0; i < ids.size(); i++) {
+            ids[i] = i;
+        }
+        std::stable_sort(ids.begin(), ids.end(), [&](uint32_t a, uint32_t b) { return key(a) < key(b); });
+        return ids;
+    };
+    static const std::string none;
+    std::vector<uint32_t> by_name = sortedBy([&](uint32_t m) -> const std::string& { return infos[m]->name; });
+    std::vector<uint32_t> by_first_param = sortedBy([&](uint32_t m) -> const std::string& {
+        return infos[m]->params.empty() ? none : infos[m]->params[0].name;
+    });
+    std::vector<uint32_t> by_return_type = sortedBy([&](uint32_t m) -> const std::string& {
+        return infos[m]->return_type ? infos[m]->return_type->text : none;
+    });
+    std::vector<uint32_t> decorated;
+    uint32_t decorated_first[5];
+    for (unsigned bit = 0; bit < 4; bit++) {
+        decorated_first[bit] = static_cast<uint32_t>(decorated.size());
+        for (uint32_t m = 0; m < methods.size(); m++) {
+            if (methods[m].decorators & (1u << bit)) {
+                decorated.push_back(m);
+            }
+        }
+    }
+    decorated_first[4] = static_cast<uint32_t>(decorated.size());
+    std::stable_sort(by_parent.begin(), by_parent.end(), [&](const IndexedParent& a, const IndexedParent& b) {
+        return pool.data().compare(a.name.offset, a.name.length, pool.data(), b.name.offset, b.name.length) < 0;
+    });
+
+    // Reverse edges, resolving parent names like ClassIndex::resolve
+    std::vector<const std::string*> names(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        names[i] = &this->classes[order[i]].info.name;
+    }
+    auto resolve = [&](size_t cls, const std::string& parent) -> int64_t {
+        auto first = std::lower_bound(names.begin(), names.end(), parent,
+            [](const std::string* name, const std::string& value) { return *name < value; });
+        size_t begin = first - names.begin();
+        size_t end = begin;
+        while (end < names.size() && *names[end] == parent) {
+            if (records[end].file == records[cls].file) {
+                return static_cast<int64_t>(end);
+            }
+            end++;
+        }
+        return begin < end ? static_cast<int64_t>(begin) : -1;
+    };
+    std::vector<std::vector<uint32_t>> children(records.size());
+    for (size_t i = 0; i < records.size(); i++) {
+        for (const std::string& parent : this->classes[order[i]].info.parents) {
+            int64_t p = resolve(i, parent);
+            if (p >= 0 && static_cast<size_t>(p) != i) {
+                children[p].push_back(static_cast<uint32_t>(i));
+            }
+        }
+    }
+    std::vector<uint32_t> child_ids;
+    for (size_t i = 0; i < records.size(); i++) {
+        records[i].first_child = static_cast<uint32_t>(child_ids.size());
+        records[i].child_count = static_cast<uint32_t>(children[i].size());
+        child_ids.insert(child_ids.end(), children[i].begin(), children[i].end());
+    }
+
+    ClassIndexHeader header;
+    std::memcpy(header.magic, "OOPI", 4);
+    header.version = INDEX_VERSION;
+    header.class_count = static_cast<uint32_t>(records.size());
+    header.file_count = static_cast<uint32_t>(file_names.size());
+    header.parent_count = static_cast<uint32_t>(parents.size());
+    header.method_count = static_cast<uint32_t>(methods.size());
+    header.child_count = static_cast<uint32_t>(child_ids.size());
+    header.string_bytes = static_cast<uint32_t>(pool.data().size());
+    std::memcpy(header.decorated_first, decorated_first, sizeof(decorated_first));
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error("Could not write file " + path);
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeArray(out, records);
+    writeArray(out, file_names);
+    writeArray(out, parents);
+    writeArray(out, methods);
+    writeArray(out, child_ids);
+    writeArray(out, by_name);
+    writeArray(out, by_first_param);
+    writeArray(out, by_return_type);
+    writeArray(out, decorated);
+    writeArray(out, by_parent);
+    out.write(pool.data().data(), static_cast<std::streamsize>(pool.data().size()));
+    if (!out) {
+        throw std::runtime_error("Could not write file " + path);
+    }
+}
+
+ClassIndex::ClassIndex(const std::string& path) : mapping(path) {
+    const char* cursor = this->mapping.data();
+    const char* end = cursor + this->mapping.size();
+    this->header = section<ClassIndexHeader>(cursor, 1, end);
+    if (std::memcmp(this->header->magic, "OOPI", 4) != 0 || this->header->version != INDEX_VERSION) {
+        throw std::runtime_error("Not a class index: " + path);
+    }
+    this->classes = section<IndexedClass>(cursor, this->header->class_count, end);
+    this->files = section<IndexString>(cursor, this->header->file_count, end);
+    this->parent_names = section<IndexString>(cursor, this->header->parent_count, end);
+    this->method_records = section<IndexedMethod>(cursor, this->header->method_count, end);
+    this->child_ids = section<uint32_t>(cursor, this->header->child_count, end);
+    this->by_name = section<uint32_t>(cursor, this->header->method_count, end);
+    this->by_first_param = section<uint32_t>(cursor, this->header->method_count, end);
+    this->by_return_type = section<uint32_t>(cursor, this->header->method_count, end);
+    this->decorated = section<uint32_t>(cursor, this->header->decorated_first[4], end);
+    this->by_parent = section<IndexedParent>(cursor, this->header->parent_count, end);
+    this->strings = section<char>(cursor, this->header->string_bytes, end);
+    if (!valid()) {
+        throw std::runtime_error("Not a class index: " + path);
+    }
+}
+
+bool ClassIndex::valid() const {
+    const ClassIndexHeader& h = *this->header;
+    // 64-bit sums, so offset + length cannot wrap around
+    auto string = [&](const IndexString& s) { return uint64_t(s.offset) + s.length <= h.string_bytes; };
+    auto range = [](uint32_t first, uint32_t count, uint32_t size) { return uint64_t(first) + count <= size; };
+    auto ids = [](const uint32_t* items, uint32_t count, uint32_t size) {
+        return std::all_of(items, items + count, [size](uint32_t id) { return id < size; });
+    };
+
+    for (uint32_t b = 0; b < 4; b++) {
+        if (h.decorated_first[b] > h.decorated_first[b + 1]) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < h.class_count; i++) {
+        const IndexedClass& c = this->classes[i];
+        if (!string(c.name) || c.file >= h.file_count || !range(c.first_parent, c.parent_count, h.parent_count) ||
+            !range(c.first_method, c.method_count, h.method_count) ||
+            !range(c.first_child, c.child_count, h.child_count)) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < h.method_count; i++) {
+        const IndexedMethod& m = this->method_records[i];
+        if (!string(m.name) || !string(m.first_param) || !string(m.return_type) || m.cls >= h.class_count) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < h.parent_count; i++) {
+        if (!string(this->parent_names[i]) || !string(this->by_parent[i].name) ||
+            this->by_parent[i].cls >= h.class_count) {
+            return false;
+        }
+    }
+    return std::all_of(this->files, this->files + h.file_count, string) &&
+           ids(this->child_ids, h.child_count, h.class_count) &&
+           ids(this->by_name, h.method_count, h.method_count) &&
+           ids(this->by_first_param, h.method_count, h.method_count) &&
+           ids(this->by_return_type, h.method_count, h.method_count) &&
+           ids(this->decorated, h.decorated_first[4], h.method_count);
+}
+
+std::pair<uint32_t, uint32_t> ClassIndex::find(std::string_view name) const {
+    const IndexedClass* end = this->classes + classCount();
+    const IndexedClass* first = std::lower_bound(this->classes, end, name,
+        [this](const IndexedClass& c, std::string_view value) { return str(c.name) < value; });
+    const IndexedClass* last = std::upper_bound(first, end, name,
+        [this](std::string_view value, const IndexedClass& c) { return value < str(c.name); });
+    return {static_cast<uint32_t>(first - this->classes), static_cast<uint32_t>(last - this->classes)};
+}
+
+std::string_view ClassIndex::name(uint32_t cls) const {
+    return str(this->classes[cls].name);
+}
+
+std::string_view ClassIndex::file(uint32_t cls) const {
+    return str(this->files[this->classes[cls].file]);
+}
+
+std::vector<std::string_view> ClassIndex::parents(uint32_t cls) const {
+    const IndexedClass& record = this->classes[cls];
+    std::vector<std::string_view> names;
+    for (uint32_t i = 0; i < record.parent_count; i++) {
+        names.push_back(str(this->parent_names[record.first_parent + i]));
+    }
+    return names;
+}
+
+std::vector<std::string_view> ClassIndex::methods(uint32_t cls) const {
+    const IndexedClass& record = this->classes[cls];
+    std::vector<std::string_view> names;
+    for (uint32_t i = 0; i < record.method_count; i++) {
+        names.push_back(str(this->method_records[record.first_method + i].name));
+    }
+    return names;
+}
+
+const IndexedMethod* ClassIndex::findMethod(uint32_t cls, std::string_view method) const {
+    const IndexedClass& record = this->classes[cls];
+    for (uint32_t i = 0; i < record.method_count; i++) {
+        const IndexedMethod& m = this->method_records[record.first_method + i];
+        if (str(m.name) == method) {
+            return &m;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<uint32_t> ClassIndex::children(uint32_t cls) const {
+    const IndexedClass& record = this->classes[cls];
+    return std::vector<uint32_t>(this->child_ids + record.first_child,
+                                 this->child_ids + record.first_child + record.child_count);
+}
+
+std::vector<uint32_t> ClassIndex::subclasses(std::string_view name) const {
+    std::vector<bool> seen(classCount(), false);
+    std::vector<uint32_t> pending;
+    std::vector<uint32_t> result;
+    auto range = find(name);
+    for (uint32_t c = range.first; c < range.second; c++) {
+        seen[c] = true;
+        pending.push_back(c);
+    }
+    while (!pending.empty()) {
+        const IndexedClass& record = this->classes[pending.back()];
+        pending.pop_back();
+        for (uint32_t i = 0; i < record.child_count; i++) {
+            uint32_t child = this->child_ids[record.first_child + i];
+            if (!seen[child]) {
+                seen[child] = true;
+                pending.push_back(child);
+                result.push_back(child);
+            }
+        }
+    }
+    // Indices follow the name order
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+int64_t ClassIndex::resolve(uint32_t cls, std::string_view parent) const {
+    auto range = find(parent);
+    for (uint32_t c = range.first; c < range.second; c++) {
+        if (this->classes[c].file == this->classes[cls].file) {
+            return c;
+        }
+    }
+    return range.first < range.second ? static_cast<int64_t>(range.first) : -1;
+}
+
+std::vector<ClassIndex::Unimplemented> ClassIndex::unimplementedAbstract() const {
+    // abstract[c]: abstract methods visible in c and the class declaring
+    // each, computed parents first along with the C3 linearization of c.
+    // A method is visible if no class before its own in the linearization
+    // defines its name. Inheritance cycles are cut where found.
+    enum State : uint8_t { UNVISITED, VISITING, DONE };
+    using Pending = std::vector<std::pair<std::string_view, uint32_t>>;
+    std::vector<Pending> abstract(classCount());
+    std::vector<Linearization<uint32_t>> mro(classCount());
+    std::vector<State> state(classCount(), UNVISITED);
+
+    auto compute = [&](uint32_t root) {
+        // Iterative post-order walk, deep hierarchies must not overflow the stack
+        std::vector<uint32_t> walk = {root};
+        while (!walk.empty()) {
+            uint32_t c = walk.back();
+            const IndexedClass& record = this->classes[c];
+            if (state[c] == UNVISITED) {
+                state[c] = VISITING;
+                for (uint32_t i = 0; i < record.parent_count; i++) {
+                    int64_t p = resolve(c, str(this->parent_names[record.first_parent + i]));
+                    if (p >= 0 && state[p] == UNVISITED) {
+                        walk.push_back(static_cast<uint32_t>(p));
+                    }
+                }
+                continue;
+            }
+            walk.pop_back();
+            if (state[c] == DONE) {
+                continue;
+            }
+            state[c] = DONE;
+
+            std::vector<uint32_t> parents;
+            std::vector<const Linearization<uint32_t>*> bases;
+            for (uint32_t i = 0; i < record.parent_count; i++) {
+                int64_t p = resolve(c, str(this->parent_names[record.first_parent + i]));
+                if (p >= 0 && state[p] == DONE && std::find(parents.begin(), parents.end(), p) == parents.end()) {
+                    parents.push_back(static_cast<uint32_t>(p));
+                    bases.push_back(&mro[p]);
+                }
+            }
+            mro[c].build(c, std::move(bases));
+
+            Pending& mine = abstract[c];
+            if (parents.size() > 1) {
+                // The first class along the linearization defining a name
+                // decides whether it is abstract
+                std::unordered_set<std::string_view> seen;
+                for (uint32_t k : mro[c]) {
+                    const IndexedClass& owner = this->classes[k];
+                    for (uint32_t i = 0; i < owner.method_count; i++) {
+                        const IndexedMethod& m = this->method_records[owner.first_method + i];
+                        if (seen.insert(str(m.name)).second && (m.decorators & DECORATOR_ABSTRACTMETHOD)) {
+                            mine.emplace_back(str(m.name), k);
+                        }
+                    }
+                }
+                continue;
+            }
+            // With one parent the linearization is c then the parent's, so
+            // c sees what its parent does but for the names it defines
+            if (!parents.empty()) {
+                for (const auto& inherited : abstract[parents[0]]) {
+                    if (!findMethod(c, inherited.first)) {
+                        mine.push_back(inherited);
+                    }
+                }
+            }
+            for (uint32_t i = 0; i < record.method_count; i++) {
+                const IndexedMethod& m = this->method_records[record.first_method + i];
+                if (m.decorators & DECORATOR_ABSTRACTMETHOD) {
+                    mine.emplace_back(str(m.name), c);
+                }
+            }
+        }
+    };
+
+    std::vector<Unimplemented> result;
+    for (uint32_t c = 0; c < classCount(); c++) {
+        if (this->classes[c].child_count != 0) {
+            continue;
+        }
+        compute(c);
+        for (const auto& pending : abstract[c]) {
+            if (pending.second != c) {
+                result.push_back({c, pending.first, pending.second});
+            }
+        }
+    }
+    return result;
+}
+
+ClassIndex::Ids ClassIndex::methodsBy(const uint32_t* sorted, IndexString IndexedMethod::*key,
+                                      std::string_view value) const {
+    const uint32_t* end = sorted + methodCount();
+    const uint32_t* first = std::lower_bound(sorted, end, value,
+        [&](uint32_t m, std::string_view v) { return str(this->method_records[m].*key) < v; });
+    const uint32_t* last = std::upper_bound(first, end, value,
+        [&](std::string_view v, uint32_t m) { return v < str(this->method_records[m].*key); });
+    return {first, last};
+}
+
+ClassIndex::Ids ClassIndex::methodsNamed(std::string_view name) const {
+    return methodsBy(this->by_name, &IndexedMethod::name, name);
+}
+
+ClassIndex::Ids ClassIndex::methodsWithFirstParam(std::string_view name) const {
+    return methodsBy(this->by_first_param, &IndexedMethod::first_param, name);
+}
+
+ClassIndex::Ids ClassIndex::methodsReturning(std::string_view type) const {
+    return methodsBy(this->by_return_type, &IndexedMethod::return_type, type);
+}
+
+ClassIndex::Ids ClassIndex::methodsDecorated(Decorator decorator) const {
+    unsigned bit = 0;
+    while (bit < 4 && (1u << bit) != decorator) {
+        bit++;
+    }
+    const uint32_t* first = this->decorated + this->header->decorated_first[std::min(bit, 4u)];
+    return {first, this->decorated + this->header->decorated_first[std::min(bit + 1, 4u)]};
+}
+
+std::vector<uint32_t> ClassIndex::classesWithParent(std::string_view name) const {
+    const IndexedParent* end = this->by_parent + this->header->parent_count;
+    const IndexedParent* first = std::lower_bound(this->by_parent, end, name,
+        [this](const IndexedParent& p, std::string_view value) { return str(p.name) < value; });
+    std::vector<uint32_t> result;
+    for (const IndexedParent* p = first; p != end && str(p->name) == name; p++) {
+        // A class naming the same parent twice is listed once
+        if (result.empty() || result.back() != p->cls) {
+            result.push_back(p->cls);
+        }
+    }
+    return result;
+}
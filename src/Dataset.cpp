@@ -0,0 +1,327 @@
+#include "Dataset.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <zlib.h>
+
+namespace {
+
+void skipSpaces(std::string_view s, size_t& i) {
+    while (i < s.size() && (s[i] == ' ' || s[i] == '\t' || s[i] == '\r' || s[i] == '\n')) {
+        i++;
+    }
+}
+
+// Moves i past the JSON string starting at s[i] (the opening quote)
+bool skipString(std::string_view s, size_t& i) {
+    for (i++; i < s.size(); i++) {
+        if (s[i] == '\\') {
+            i++;
+        } else if (s[i] == '"') {
+            i++;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Moves i past the JSON value starting at s[i]
+bool skipValue(std::string_view s, size_t& i) {
+    if (i < s.size() && s[i] == '"') {
+        return skipString(s, i);
+    }
+    int depth = 0;
+    while (i < s.size()) {
+        char c = s[i];
+        if (c == '"') {
+            if (!skipString(s, i)) {
+                return false;
+            }
+            continue;
+        }
+        if (c == '{' || c == '[') {
+            depth++;
+        } else if (c == '}' || c == ']') {
+            if (depth == 0) {
+                return true;
+            }
+            depth--;
+        } else if (c == ',' && depth == 0) {
+            return true;
+        }
+        i++;
+    }
+    return depth == 0;
+}
+
+int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool readHex4(std::string_view s, size_t i, unsigned& value) {
+    if (i + 4 > s.size()) {
+        return false;
+    }
+    value = 0;
+    for (size_t k = i; k < i + 4; k++) {
+        int digit = hexValue(s[k]);
+        if (digit < 0) {
+            return false;
+        }
+        value = value * 16 + static_cast<unsigned>(digit);
+    }
+    return true;
+}
+
+void appendUtf8(std::string& out, unsigned cp) {
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+// Decodes the JSON string starting at s[i] (the opening quote) into out
+bool decodeString(std::string_view s, size_t i, std::string& out) {
+    out.clear();
+    for (i++; i < s.size(); i++) {
+        char c = s[i];
+        if (c == '"') {
+            return true;
+        }
+        if (c != '\\') {
+            out += c;
+            continue;
+        }
+        if (++i >= s.size()) {
+            return false;
+        }
+        switch (s[i]) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                unsigned cp = 0;
+                if (!readHex4(s, i + 1, cp)) {
+                    return false;
+                }
+                i += 4;
+                // Characters outside the BMP come as a surrogate pair
+                unsigned low = 0;
+                if (cp >= 0xD800 && cp < 0xDC00 && i + 2 < s.size() &&
+                    s[i + 1] == '\\' && s[i + 2] == 'u' && readHex4(s, i + 3, low) &&
+                    low >= 0xDC00 && low < 0xE000) {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    i += 6;
+                }
+                appendUtf8(out, cp);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return false;
+}
+
+// Moves i to the value stored under key in a one-line JSON object
+bool findField(std::string_view record, std::string_view key, size_t& i) {
+    i = 0;
+    skipSpaces(record, i);
+    if (i >= record.size() || record[i] != '{') {
+        return false;
+    }
+    i++;
+    while (true) {
+        skipSpaces(record, i);
+        if (i >= record.size() || record[i] != '"') {
+            return false;
+        }
+        // Keys in our datasets have no escapes, compare them in place
+        size_t key_begin = i + 1;
+        if (!skipString(record, i)) {
+            return false;
+        }
+        std::string_view name = record.substr(key_begin, i - 1 - key_begin);
+        skipSpaces(record, i);
+        if (i >= record.size() || record[i] != ':') {
+            return false;
+        }
+        i++;
+        skipSpaces(record, i);
+        if (name == key) {
+            return i < record.size();
+        }
+        if (!skipValue(record, i)) {
+            return false;
+        }
+        skipSpaces(record, i);
+        if (i >= record.size() || record[i] != ',') {
+            return false;
+        }
+        i++;
+    }
+}
+
+}
+
+bool jsonStringField(std::string_view record, std::string_view key, std::string& out) {
+    size_t i;
+    return findField(record, key, i) && record[i] == '"' && decodeString(record, i, out);
+}
+
+bool jsonIntField(std::string_view record, std::string_view key, int64_t& out) {
+    size_t i;
+    if (!findField(record, key, i)) {
+        return false;
+    }
+    bool negative = record[i] == '-';
+    size_t first = i + negative;
+    uint64_t value = 0;
+    for (i = first; i < record.size() && record[i] >= '0' && record[i] <= '9'; i++) {
+        value = value * 10 + static_cast<uint64_t>(record[i] - '0');
+    }
+    out = negative ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+    return i > first;
+}
+
+bool jsonBoolField(std::string_view record, std::string_view key, bool& out) {
+    size_t i;
+    if (!findField(record, key, i)) {
+        return false;
+    }
+    out = record.compare(i, 4, "true") == 0;
+    return out || record.compare(i, 5, "false") == 0;
+}
+
+// Text of a gzip file, decompressed one input chunk at a time
+struct DatasetReader::Inflater {
+    z_stream stream;
+    std::vector<unsigned char> input = std::vector<unsigned char>(64 * 1024);
+    bool member_done = false;  // At the end of a gzip member
+
+    Inflater() {
+        std::memset(&this->stream, 0, sizeof(this->stream));
+        // 16 + MAX_WBITS: gzip header and trailer
+        if (inflateInit2(&this->stream, 16 + MAX_WBITS) != Z_OK) {
+            throw std::runtime_error("Cannot initialize zlib");
+        }
+    }
+    ~Inflater() { inflateEnd(&this->stream); }
+};
+
+DatasetReader::DatasetReader(const std::string& filename, std::string field)
+    : file(filename, std::ios::binary), filename(filename), field(std::move(field)), window(256 * 1024) {
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open dataset file: " + filename);
+    }
+    char magic[2] = {0, 0};
+    file.read(magic, 2);
+    bool gzip = file.gcount() == 2 && static_cast<unsigned char>(magic[0]) == 0x1f &&
+                static_cast<unsigned char>(magic[1]) == 0x8b;
+    file.clear();
+    file.seekg(0);
+    if (gzip) {
+        inflater = std::make_unique<Inflater>();
+    }
+}
+
+DatasetReader::~DatasetReader() = default;
+
+bool DatasetReader::next(std::string& code) {
+    while (true) {
+        const char* text = window.data();
+        const char* newline = static_cast<const char*>(std::memchr(text + scanned, '\n', end - scanned));
+        size_t line_end;
+        if (newline) {
+            line_end = static_cast<size_t>(newline - text);
+        } else if (fill()) {
+            continue;
+        } else if (begin < end) {
+            line_end = end;  // Last line, with no newline
+        } else {
+            return false;
+        }
+        std::string_view line(text + begin, line_end - begin);
+        begin = scanned = std::min(line_end + 1, end);
+        line_number++;
+        if (jsonStringField(line, field, code)) {
+            return true;
+        }
+    }
+}
+
+bool DatasetReader::fill() {
+    // Keep the unconsumed tail at the front, and grow the window only when
+    // one record fills it
+    if (begin > 0) {
+        std::memmove(window.data(), window.data() + begin, end - begin);
+        end -= begin;
+        scanned -= begin;
+        begin = 0;
+    }
+    if (end == window.size()) {
+        window.resize(window.size() * 2);
+    }
+    scanned = end;
+    size_t n = at_end ? 0 : read(window.data() + end, window.size() - end);
+    at_end = n == 0;
+    end += n;
+    return n > 0;
+}
+
+// Reads up to size bytes of text, 0 at the end of the input
+size_t DatasetReader::read(char* out, size_t size) {
+    if (!inflater) {
+        file.read(out, static_cast<std::streamsize>(size));
+        return static_cast<size_t>(file.gcount());
+    }
+
+    z_stream& stream = inflater->stream;
+    stream.next_out = reinterpret_cast<unsigned char*>(out);
+    stream.avail_out = static_cast<uInt>(size);
+    while (stream.avail_out == size) {
+        if (stream.avail_in == 0) {
+            file.read(reinterpret_cast<char*>(inflater->input.data()),
+                      static_cast<std::streamsize>(inflater->input.size()));
+            stream.next_in = inflater->input.data();
+            stream.avail_in = static_cast<uInt>(file.gcount());
+            if (stream.avail_in == 0) {
+                if (!inflater->member_done) {
+                    throw std::runtime_error("Truncated gzip data in dataset file: " + filename);
+                }
+                break;
+            }
+        }
+        if (inflater->member_done) {
+            // Another member follows, as in files joined with cat
+            inflateReset(&stream);
+            inflater->member_done = false;
+        }
+        int status = inflate(&stream, Z_NO_FLUSH);
+        if (status == Z_STREAM_END) {
+            inflater->member_done = true;
+        } else if (status != Z_OK && status != Z_BUF_ERROR) {
+            throw std::runtime_error("Corrupt gzip data in dataset file: " + filename);
+        }
+    }
+    return size - stream.avail_out;
+}
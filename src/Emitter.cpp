@@ -0,0 +1,225 @@
+#include "Emitter.h"
+#include "Num.h"
+#include "Str.h"
+#include "Word.h"
+
+namespace {
+
+const char* const DECORATOR_NAMES[] = {"property", "staticmethod", "classmethod", "abstractmethod"};
+
+void appendSignature(const MethodInfo& method, std::string& out) {
+    out += "def ";
+    out += method.name;
+    out += '(';
+    for (size_t i = 0; i < method.params.size(); i++) {
+        const ParamInfo& param = method.params[i];
+        if (i > 0) {
+            out += ", ";
+        }
+        out.append(param.stars, '*');
+        out += param.name;
+        if (param.type) {
+            out += ": ";
+            out += param.type->text;
+        }
+        if (param.has_default) {
+            out += " = ...";
+        }
+    }
+    out += ')';
+    if (method.return_type) {
+        out += " -> ";
+        out += method.return_type->text;
+    }
+    out += '\n';
+}
+
+void appendMethod(const MethodInfo& method, const char* indent, std::string& out) {
+    for (int bit = 0; bit < 4; bit++) {
+        if (method.decorators & (1u << bit)) {
+            out += indent;
+            out += '@';
+            out += DECORATOR_NAMES[bit];
+            out += '\n';
+        }
+    }
+    out += indent;
+    appendSignature(method, out);
+}
+
+void appendBody(const Outline& outline, const MethodInfo& method, const TokenStream& stream, std::string& out) {
+    out += method.name;
+    out += ' ';
+    out += dumpAst(outline.ast, method.body, stream);
+    out += '\n';
+}
+
+void appendJsonMethods(const std::vector<MethodInfo>& methods, std::string& out) {
+    out += '[';
+    for (size_t i = 0; i < methods.size(); i++) {
+        const MethodInfo& method = methods[i];
+        out += (i > 0 ? ",{\"name\":" : "{\"name\":");
+        appendJsonString(out, method.name);
+        out += ",\"decorators\":[";
+        bool first = true;
+        for (int bit = 0; bit < 4; bit++) {
+            if (method.decorators & (1u << bit)) {
+                out += (first ? "\"" : ",\"");
+                out += DECORATOR_NAMES[bit];
+                out += '"';
+                first = false;
+            }
+        }
+        out += "],\"params\":[";
+        for (size_t j = 0; j < method.params.size(); j++) {
+            const ParamInfo& param = method.params[j];
+            out += (j > 0 ? ",{\"name\":" : "{\"name\":");
+            appendJsonString(out, param.name);
+            if (param.type) {
+                out += ",\"type\":";
+                appendJsonString(out, param.type->text);
+            }
+            if (param.stars != 0) {
+                out += ",\"stars\":";
+                out += static_cast<char>('0' + param.stars);
+            }
+            if (param.has_default) {
+                out += ",\"default\":true";
+            }
+            out += '}';
+        }
+        out += ']';
+        if (method.return_type) {
+            out += ",\"returns\":";
+            appendJsonString(out, method.return_type->text);
+        }
+        out += '}';
+    }
+    out += ']';
+}
+
+}
+
+bool parseEmitMode(std::string_view name, EmitMode& mode) {
+    if (name == "tokens") {
+        mode = EmitMode::Tokens;
+    } else if (name == "outline") {
+        mode = EmitMode::Outline;
+    } else if (name == "json") {
+        mode = EmitMode::Json;
+    } else if (name == "bin") {
+        mode = EmitMode::Binary;
+    } else if (name == "ast") {
+        mode = EmitMode::Ast;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void appendJsonString(std::string& out, std::string_view s) {
+    static const char hex[] = "0123456789abcdef";
+    out += '"';
+    for (char c : s) {
+        switch (c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        case '\t': out += "\\t"; break;
+        case '\r': out += "\\r"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out += "\\u00";
+                out += hex[(c >> 4) & 0xf];
+                out += hex[c & 0xf];
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+void emitTokens(const TokenStream& stream, std::string& out) {
+    for (size_t i = 0; i < stream.size(); i++) {
+        Token* token = stream.at(i);
+        out += tagName(token->tag);
+        if (Word* word = dynamic_cast<Word*>(token)) {
+            out += '\t';
+            out += word->lexeme;
+        } else if (Str* str = dynamic_cast<Str*>(token)) {
+            // Quoted, so docstrings stay on one line
+            out += '\t';
+            appendJsonString(out, str->raw);
+        } else if (Num* num = dynamic_cast<Num*>(token)) {
+            out += '\t';
+            out += num->toString();
+        }
+        out += '\n';
+    }
+}
+
+void emitOutline(const Outline& outline, std::string& out) {
+    for (const ClassInfo& cls : outline.classes) {
+        out += "class ";
+        out += cls.name;
+        if (!cls.parents.empty()) {
+            out += '(';
+            for (size_t i = 0; i < cls.parents.size(); i++) {
+                if (i > 0) {
+                    out += ", ";
+                }
+                out += cls.parents[i];
+            }
+            out += ')';
+        }
+        out += '\n';
+        for (const MethodInfo& method : cls.methods) {
+            appendMethod(method, "    ", out);
+        }
+    }
+    for (const MethodInfo& function : outline.functions) {
+        appendMethod(function, "", out);
+    }
+}
+
+void emitJson(std::string_view file, const Outline& outline, std::string_view error, std::string& out) {
+    out += "{\"file\":";
+    appendJsonString(out, file);
+    out += ",\"classes\":[";
+    for (size_t i = 0; i < outline.classes.size(); i++) {
+        const ClassInfo& cls = outline.classes[i];
+        out += (i > 0 ? ",{\"name\":" : "{\"name\":");
+        appendJsonString(out, cls.name);
+        out += ",\"parents\":[";
+        for (size_t j = 0; j < cls.parents.size(); j++) {
+            if (j > 0) {
+                out += ',';
+            }
+            appendJsonString(out, cls.parents[j]);
+        }
+        out += "],\"methods\":";
+        appendJsonMethods(cls.methods, out);
+        out += '}';
+    }
+    out += "],\"functions\":";
+    appendJsonMethods(outline.functions, out);
+    if (!error.empty()) {
+        out += ",\"error\":";
+        appendJsonString(out, error);
+    }
+    out += "}\n";
+}
+
+void emitAst(const Outline& outline, const TokenStream& stream, std::string& out) {
+    for (const ClassInfo& cls : outline.classes) {
+        for (const MethodInfo& method : cls.methods) {
+            out += cls.name;
+            out += '.';
+            appendBody(outline, method, stream, out);
+        }
+    }
+    for (const MethodInfo& function : outline.functions) {
+        appendBody(outline, function, stream, out);
+    }
+}
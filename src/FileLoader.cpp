@@ -0,0 +1,464 @@
+#include "FileLoader.h"
+#include "Lexer.h"
+#include "Stats.h"
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// io_uring is driven through its system calls, so no liburing is needed
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define FILE_LOADER_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace {
+
+std::string openError(const std::string& path) {
+    return "Cannot open source file: " + path;
+}
+
+// Reads a whole file into file.contents with pread, or sets file.error
+void readWhole(const std::string& path, FileLoader::File& file) {
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        file.error = openError(path);
+        return;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        file.error = openError(path);
+        return;
+    }
+    std::string& contents = *file.contents;
+    contents.resize(static_cast<size_t>(info.st_size));
+    size_t done = 0;
+    while (done < contents.size()) {
+        ssize_t n = pread(fd, &contents[done], contents.size() - done, static_cast<off_t>(done));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            file.error = "Cannot read source file: " + path;
+            break;
+        }
+        if (n == 0) {
+            break;  // Shrank since fstat
+        }
+        done += static_cast<size_t>(n);
+    }
+    contents.resize(done);
+    close(fd);
+#else
+    try {
+        Lexer::readFile(path, *file.contents);
+    } catch (const std::runtime_error& e) {
+        file.error = e.what();
+    }
+#endif
+}
+
+}
+
+#ifdef FILE_LOADER_IO_URING
+
+// A ring mapped into the process. There is one submitter and one reaper,
+// the loader thread, so only the kernel's side of the indices needs
+// atomic accesses.
+struct FileLoader::Ring {
+    int fd = -1;
+    void* sq_map = MAP_FAILED;
+    size_t sq_size = 0;
+    void* cq_map = MAP_FAILED;
+    size_t cq_size = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqes_size = 0;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned sq_mask = 0;
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned cq_mask = 0;
+    io_uring_cqe* cqes = nullptr;
+    unsigned unsubmitted = 0;
+
+    ~Ring() {
+        if (this->sqes != MAP_FAILED) {
+            munmap(this->sqes, this->sqes_size);
+        }
+        if (this->cq_map != MAP_FAILED && this->cq_map != this->sq_map) {
+            munmap(this->cq_map, this->cq_size);
+        }
+        if (this->sq_map != MAP_FAILED) {
+            munmap(this->sq_map, this->sq_size);
+        }
+        if (this->fd >= 0) {
+            close(this->fd);
+        }
+    }
+
+    // False if the kernel has no io_uring, forbids it (seccomp, sysctl) or
+    // lacks one of the operations used
+    bool open(unsigned entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        this->fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+        if (this->fd < 0 || !supports({IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_CLOSE})) {
+            return false;
+        }
+
+        this->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        this->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single) {
+            this->sq_size = this->cq_size = std::max(this->sq_size, this->cq_size);
+        }
+        this->sq_map = mmap(nullptr, this->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->fd,
+                            IORING_OFF_SQ_RING);
+        if (this->sq_map == MAP_FAILED) {
+            return false;
+        }
+        this->cq_map = single ? this->sq_map
+                              : mmap(nullptr, this->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                     this->fd, IORING_OFF_CQ_RING);
+        if (this->cq_map == MAP_FAILED) {
+            return false;
+        }
+        this->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = mmap(nullptr, this->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, this->fd,
+                          IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            return false;
+        }
+        this->sqes = static_cast<io_uring_sqe*>(sqes);
+
+        char* sq = static_cast<char*>(this->sq_map);
+        this->sq_tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        this->sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        this->sq_mask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        char* cq = static_cast<char*>(this->cq_map);
+        this->cq_head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        this->cq_tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        this->cq_mask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        this->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    bool supports(std::initializer_list<int> ops) const {
+        // Kernels before 5.6 have no probe, nor the operations
+        std::vector<char> buffer(sizeof(io_uring_probe) + 256 * sizeof(io_uring_probe_op), 0);
+        io_uring_probe* probe = reinterpret_cast<io_uring_probe*>(buffer.data());
+        if (syscall(__NR_io_uring_register, this->fd, IORING_REGISTER_PROBE, probe, 256) < 0) {
+            return false;
+        }
+        for (int op : ops) {
+            if (op > probe->last_op || !(probe->ops[op].flags & IO_URING_OP_SUPPORTED)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Queues entry; it goes to the kernel with the next wait()
+    void push(const io_uring_sqe& entry) {
+        unsigned tail = *this->sq_tail;
+        unsigned slot = tail & this->sq_mask;
+        this->sqes[slot] = entry;
+        this->sq_array[slot] = slot;
+        __atomic_store_n(this->sq_tail, tail + 1, __ATOMIC_RELEASE);
+        this->unsubmitted++;
+    }
+
+    // Submits the queued entries and waits for at least one completion;
+    // false if the ring failed
+    bool wait() {
+        for (;;) {
+            long n = syscall(__NR_io_uring_enter, this->fd, this->unsubmitted, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (n >= 0) {
+                this->unsubmitted -= std::min(this->unsubmitted, static_cast<unsigned>(n));
+                if (this->unsubmitted == 0) {
+                    return true;
+                }
+                continue;
+            }
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                return false;
+            }
+        }
+    }
+
+    // Calls handle(user_data, res) on every completion there is
+    template <typename Handler>
+    void reap(Handler handle) {
+        unsigned head = *this->cq_head;
+        unsigned tail = __atomic_load_n(this->cq_tail, __ATOMIC_ACQUIRE);
+        for (; head != tail; head++) {
+            const io_uring_cqe& cqe = this->cqes[head & this->cq_mask];
+            handle(cqe.user_data, cqe.res);
+        }
+        __atomic_store_n(this->cq_head, head, __ATOMIC_RELEASE);
+    }
+};
+
+#else
+
+struct FileLoader::Ring {
+    bool open(unsigned) { return false; }
+};
+
+#endif
+
+bool FileLoader::ioUringAvailable() {
+    Ring ring;
+    return ring.open(1);
+}
+
+FileLoader::FileLoader(std::vector<std::string> paths, Backend backend, unsigned depth, unsigned threads)
+    : paths(std::move(paths)), depth(std::max(1u, depth)) {
+    if (backend != Backend::Threads && !this->paths.empty()) {
+        this->ring = std::make_unique<Ring>();
+        if (!this->ring->open(static_cast<unsigned>(this->depth))) {
+            this->ring.reset();
+            if (backend == Backend::IoUring) {
+                throw std::runtime_error("io_uring is not available");
+            }
+        }
+    }
+    if (this->ring) {
+        this->used = Backend::IoUring;
+        this->workers.emplace_back(&FileLoader::readWithRing, this);
+        return;
+    }
+    threads = static_cast<unsigned>(std::min<size_t>({std::max(1u, threads), this->depth, this->paths.size()}));
+    for (unsigned t = 0; t < threads; t++) {
+        this->workers.emplace_back(&FileLoader::readWithThreads, this);
+    }
+}
+
+FileLoader::~FileLoader() {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->stopping = true;
+    }
+    this->changed.notify_all();
+    for (std::thread& worker : this->workers) {
+        worker.join();
+    }
+}
+
+bool FileLoader::next(File& file) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->changed.wait(lock, [this]() { return !this->loaded.empty() || this->taken == this->paths.size(); });
+    if (this->loaded.empty()) {
+        return false;
+    }
+    file = std::move(this->loaded.front());
+    this->loaded.pop_front();
+    this->taken++;
+    lock.unlock();
+    // Room for one more file
+    this->changed.notify_all();
+    return true;
+}
+
+bool FileLoader::claim(bool wait, size_t& index) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    auto room = [this]() { return this->loaded.size() + this->active < this->depth; };
+    if (wait) {
+        this->changed.wait(lock, [&]() {
+            return this->stopping || this->started == this->paths.size() || room();
+        });
+    }
+    if (this->stopping || this->started == this->paths.size() || !room()) {
+        return false;
+    }
+    index = this->started++;
+    this->active++;
+    return true;
+}
+
+void FileLoader::finish(File file) {
+    STATS_ADD(files_read, 1);
+    STATS_ADD(bytes_read, file.contents->size());
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->active--;
+        this->loaded.push_back(std::move(file));
+    }
+    this->changed.notify_all();
+}
+
+void FileLoader::readWithThreads() {
+    size_t index;
+    while (claim(true, index)) {
+        File file;
+        file.index = index;
+        file.contents = std::make_shared<std::string>();
+        readWhole(this->paths[index], file);
+        finish(std::move(file));
+    }
+}
+
+#ifdef FILE_LOADER_IO_URING
+
+// Each file goes through open, reads until its size is reached and close,
+// one operation at a time; up to depth files are at different steps, and
+// every step of all of them since the last wait goes in one system call.
+void FileLoader::readWithRing() {
+    enum class Step { Open, Read, Close };
+    struct Slot {
+        File file;
+        int fd = -1;
+        size_t done = 0;
+        Step step = Step::Open;
+    };
+    Ring& ring = *this->ring;
+    std::vector<Slot> slots(this->depth);
+    std::vector<uint32_t> free_slots;
+    for (size_t i = this->depth; i-- > 0;) {
+        free_slots.push_back(static_cast<uint32_t>(i));
+    }
+
+    auto entry = [](uint8_t opcode, int fd, uint32_t slot) {
+        io_uring_sqe sqe;
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = opcode;
+        sqe.fd = fd;
+        sqe.user_data = slot;
+        return sqe;
+    };
+    auto submitRead = [&](uint32_t id) {
+        Slot& slot = slots[id];
+        std::string& contents = *slot.file.contents;
+        io_uring_sqe sqe = entry(IORING_OP_READ, slot.fd, id);
+        sqe.addr = reinterpret_cast<uintptr_t>(&contents[slot.done]);
+        sqe.len = static_cast<uint32_t>(std::min<size_t>(contents.size() - slot.done, INT_MAX));
+        sqe.off = slot.done;
+        slot.step = Step::Read;
+        ring.push(sqe);
+    };
+    auto submitClose = [&](uint32_t id) {
+        Slot& slot = slots[id];
+        slot.file.contents->resize(slot.done);
+        slot.step = Step::Close;
+        ring.push(entry(IORING_OP_CLOSE, slot.fd, id));
+    };
+    auto release = [&](uint32_t id) {
+        Slot& slot = slots[id];
+        finish(std::move(slot.file));
+        slot = Slot();
+        free_slots.push_back(id);
+    };
+
+    size_t index;
+    while (true) {
+        // Waits for room only when nothing is in flight
+        while (!free_slots.empty() && claim(free_slots.size() == this->depth, index)) {
+            uint32_t id = free_slots.back();
+            free_slots.pop_back();
+            Slot& slot = slots[id];
+            slot.file.index = index;
+            slot.file.contents = std::make_shared<std::string>();
+            io_uring_sqe sqe = entry(IORING_OP_OPENAT, AT_FDCWD, id);
+            sqe.addr = reinterpret_cast<uintptr_t>(this->paths[index].c_str());
+            sqe.open_flags = O_RDONLY | O_CLOEXEC;
+            ring.push(sqe);
+        }
+        if (free_slots.size() == this->depth) {
+            return;
+        }
+
+        if (!ring.wait()) {
+            // The ring broke: finish the files in flight with pread, as
+            // the thread backend does with the rest
+            for (uint32_t id = 0; id < slots.size(); id++) {
+                Slot& slot = slots[id];
+                if (slot.file.contents) {
+                    if (slot.fd >= 0) {
+                        close(slot.fd);
+                    }
+                    slot.file.error.clear();
+                    readWhole(this->paths[slot.file.index], slot.file);
+                    release(id);
+                }
+            }
+            readWithThreads();
+            return;
+        }
+
+        ring.reap([&](uint64_t user_data, int32_t res) {
+            uint32_t id = static_cast<uint32_t>(user_data);
+            Slot& slot = slots[id];
+            const std::string& path = this->paths[slot.file.index];
+            switch (slot.step) {
+                case Step::Open: {
+                    struct stat info;
+                    if (res < 0) {
+                        slot.file.error = openError(path);
+                        release(id);
+                        break;
+                    }
+                    slot.fd = res;
+                    // The inode was just read by the open, so this is cheap
+                    if (fstat(slot.fd, &info) != 0) {
+                        slot.file.error = openError(path);
+                        submitClose(id);
+                        break;
+                    }
+                    slot.file.contents->resize(static_cast<size_t>(info.st_size));
+                    if (info.st_size > 0) {
+                        submitRead(id);
+                    } else {
+                        submitClose(id);
+                    }
+                    break;
+                }
+                case Step::Read:
+                    if (res == -EINTR || res == -EAGAIN) {
+                        submitRead(id);
+                        break;
+                    }
+                    if (res < 0) {
+                        slot.file.error = "Cannot read source file: " + path;
+                        submitClose(id);
+                        break;
+                    }
+                    slot.done += static_cast<size_t>(res);
+                    // A short read is retried; none at all means the file
+                    // shrank since fstat
+                    if (res > 0 && slot.done < slot.file.contents->size()) {
+                        submitRead(id);
+                    } else {
+                        submitClose(id);
+                    }
+                    break;
+                case Step::Close:
+                    release(id);
+                    break;
+            }
+        });
+    }
+}
+
+#else
+
+void FileLoader::readWithRing() {
+    readWithThreads();
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include "Indentation.h"
+
+size_t skipStringLiteral(std::string_view source, size_t i, int& line) {
+    size_t n = source.size();
+    char quote = source[i++];
+    bool triple = i + 1 < n && source[i] == quote && source[i + 1] == quote;
+    if (!triple && i < n && source[i] == quote) {
+        return i + 1;  // Empty string
+    }
+    if (triple) {
+        i += 2;
+    }
+    while (i < n) {
+        char c = source[i];
+        if (c == '\\') {
+            i++;
+            if (i < n && source[i] == '\n') {
+                line++;
+            }
+        } else if (c == quote) {
+            if (!triple) {
+                return i + 1;
+            }
+            if (i + 2 < n && source[i + 1] == quote && source[i + 2] == quote) {
+                return i + 3;
+            }
+        } else if (c == '\n') {
+            if (!triple) {
+                return i;  // Unterminated, the lexer reports it
+            }
+            line++;
+        }
+        i++;
+    }
+    return n;
+}
+
+void measureIndentation(std::string_view source, int tab_width, bool check_tabs,
+                        std::pmr::vector<LineIndent>& lines) {
+    lines.clear();
+    // Widths of the open blocks, measured with tabs of tab_width and of one
+    // column. A handful of levels is typical; the vectors are small.
+    std::vector<int> widths = {0};
+    std::vector<int> alt_widths = {0};
+    bool failed = false;
+    size_t n = source.size();
+
+    forEachLineStart(source, [&](size_t i, int line) {
+        lines.resize(static_cast<size_t>(line));
+        if (failed) {
+            return;
+        }
+        int width = 0;
+        int alt_width = 0;
+        for (; i < n; i++) {
+            char c = source[i];
+            if (c == ' ') {
+                width++;
+                alt_width++;
+            } else if (c == '\t') {
+                width = (width / tab_width + 1) * tab_width;
+                alt_width++;
+            } else if (c != '\r') {
+                break;
+            }
+        }
+        if (i == n || source[i] == '\n' || source[i] == '#') {
+            return;  // Blank
+        }
+
+        LineIndent& indent = lines.back();
+        indent.width = width;
+        indent.status = LineIndent::Ok;
+        if (width > widths.back()) {
+            if (check_tabs && alt_width <= alt_widths.back()) {
+                indent.status = LineIndent::Inconsistent;
+            }
+            widths.push_back(width);
+            alt_widths.push_back(alt_width);
+        } else {
+            while (width < widths.back()) {
+                widths.pop_back();
+                alt_widths.pop_back();
+            }
+            if (width != widths.back()) {
+                indent.status = LineIndent::BadDedent;
+            } else if (check_tabs && alt_width != alt_widths.back()) {
+                indent.status = LineIndent::Inconsistent;
+            }
+        }
+        indent.depth = static_cast<int>(widths.size()) - 1;
+        failed = indent.status != LineIndent::Ok;
+    });
+}
@@ -0,0 +1,161 @@
+#include "IndexQuery.h"
+#include "Lexer.h"
+#include "RecursiveDescendant.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace {
+
+const char* const DECORATOR_NAMES[] = {"property", "staticmethod", "classmethod", "abstractmethod"};
+
+Decorator decoratorNamed(const std::string& name) {
+    for (unsigned bit = 0; bit < 4; bit++) {
+        if (name == DECORATOR_NAMES[bit] || name == std::string("@") + DECORATOR_NAMES[bit]) {
+            return static_cast<Decorator>(1u << bit);
+        }
+    }
+    throw std::runtime_error("Unknown decorator in query: " + name);
+}
+
+// The spelling the index stores for a type hint, by parsing it as one
+std::string normalizeType(const std::string& type) {
+    Lexer lexer;
+    lexer.resetText("def f(self) -> " + type + ":\n    pass\n");
+    TokenStream stream;
+    RecursiveDescendant parser(nullptr);
+    try {
+        lexer.generateStream(stream);
+        parser.reset(&stream);
+        parser.parse();
+    } catch (const std::runtime_error&) {
+        throw std::runtime_error("Invalid type in query: " + type);
+    }
+    const Outline& outline = parser.outline();
+    if (outline.functions.size() != 1 || !outline.functions[0].return_type) {
+        throw std::runtime_error("Invalid type in query: " + type);
+    }
+    return outline.functions[0].return_type->text;
+}
+
+// Terms are separated by the commas outside brackets, which belong to types
+std::vector<std::string> splitTerms(const std::string& text) {
+    std::vector<std::string> terms(1);
+    int depth = 0;
+    for (char c : text) {
+        if (c == ',' && depth == 0) {
+            terms.emplace_back();
+            continue;
+        }
+        depth += c == '[' ? 1 : c == ']' ? -1 : 0;
+        terms.back() += c;
+    }
+    return terms;
+}
+
+std::vector<uint32_t> intersect(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+    std::vector<uint32_t> result;
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(result));
+    return result;
+}
+
+}
+
+IndexQuery IndexQuery::parse(const std::string& text) {
+    static const std::pair<const char*, Key> keys[] = {
+        {"method", Key::Method}, {"decorator", Key::Decorator}, {"first", Key::First},
+        {"returns", Key::Returns}, {"class", Key::Class}, {"parent", Key::Parent}
+    };
+    IndexQuery query;
+    for (std::string term : splitTerms(text)) {
+        term.erase(0, term.find_first_not_of(' '));
+        term.erase(term.find_last_not_of(' ') + 1);
+        size_t equals = term.find('=');
+        if (equals == std::string::npos || equals + 1 == term.size()) {
+            throw std::runtime_error("Invalid query term: " + term);
+        }
+        std::string key = term.substr(0, equals);
+        std::string value = term.substr(equals + 1);
+        auto known = std::find_if(std::begin(keys), std::end(keys),
+                                  [&](const std::pair<const char*, Key>& k) { return key == k.first; });
+        if (known == std::end(keys)) {
+            throw std::runtime_error("Unknown query key: " + key);
+        }
+        if (known->second == Key::Decorator) {
+            decoratorNamed(value);
+        } else if (known->second == Key::Returns) {
+            value = normalizeType(value);
+        }
+        query.terms.emplace_back(known->second, value);
+    }
+    return query;
+}
+
+bool IndexQuery::findsMethods() const {
+    return std::any_of(this->terms.begin(), this->terms.end(), [](const std::pair<Key, std::string>& term) {
+        return term.first != Key::Class && term.first != Key::Parent;
+    });
+}
+
+std::vector<uint32_t> IndexQuery::classes(const ClassIndex& index, bool& constrained) const {
+    constrained = false;
+    std::vector<uint32_t> result;
+    for (const auto& term : this->terms) {
+        std::vector<uint32_t> ids;
+        if (term.first == Key::Class) {
+            auto range = index.find(term.second);
+            for (uint32_t c = range.first; c < range.second; c++) {
+                ids.push_back(c);
+            }
+        } else if (term.first == Key::Parent) {
+            ids = index.classesWithParent(term.second);
+        } else {
+            continue;
+        }
+        result = constrained ? intersect(result, ids) : std::move(ids);
+        constrained = true;
+    }
+    return result;
+}
+
+std::vector<uint32_t> IndexQuery::run(const ClassIndex& index) const {
+    bool constrained;
+    std::vector<uint32_t> classes = this->classes(index, constrained);
+    if (!findsMethods()) {
+        return classes;
+    }
+
+    std::vector<ClassIndex::Ids> lists;
+    for (const auto& term : this->terms) {
+        switch (term.first) {
+            case Key::Method:
+                lists.push_back(index.methodsNamed(term.second));
+                break;
+            case Key::Decorator:
+                lists.push_back(index.methodsDecorated(decoratorNamed(term.second)));
+                break;
+            case Key::First:
+                lists.push_back(index.methodsWithFirstParam(term.second));
+                break;
+            case Key::Returns:
+                lists.push_back(index.methodsReturning(term.second));
+                break;
+            default:
+                break;
+        }
+    }
+    // Walk the smallest list, probing the others
+    std::sort(lists.begin(), lists.end(),
+              [](const ClassIndex::Ids& a, const ClassIndex::Ids& b) { return a.size() < b.size(); });
+    std::vector<uint32_t> result;
+    for (uint32_t m : lists[0]) {
+        bool match = !constrained || std::binary_search(classes.begin(), classes.end(), index.method(m).cls);
+        for (size_t i = 1; match && i < lists.size(); i++) {
+            match = std::binary_search(lists[i].begin(), lists[i].end(), m);
+        }
+        if (match) {
+            result.push_back(m);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,38 @@
+#include "LL1Parser.h"
+#include "LL1Tables.h"
+#include "Stats.h"
+#include <string>
+
+LL1Parser::LL1Parser(TokenStream* stream) : Parser(stream) {
+}
+
+void LL1Parser::parse() {
+    STATS_TIMER(Phase::Parse);
+    this->symbols.clear();
+    this->symbols.push_back(ll1::END);
+    this->symbols.push_back(static_cast<int16_t>(ll1::START));
+
+    while (!this->symbols.empty()) {
+        int top = this->symbols.back();
+        this->symbols.pop_back();
+        int terminal = this->look ? this->look->tag : ll1::END;
+
+        if (top < ll1::FIRST_NONTERMINAL) {
+            if (top != terminal) {
+                error("Unexpected token");
+            }
+            if (this->look) {
+                move();
+            }
+            continue;
+        }
+
+        int production = ll1::PREDICT[(top - ll1::FIRST_NONTERMINAL) * ll1::TERMINAL_COUNT + terminal];
+        if (production < 0) {
+            error(std::string("Unexpected token in ") + ll1::NONTERMINAL_NAMES[top - ll1::FIRST_NONTERMINAL]);
+        }
+        this->symbols.insert(this->symbols.end(),
+                             ll1::RHS + ll1::RHS_BEGIN[production],
+                             ll1::RHS + ll1::RHS_BEGIN[production + 1]);
+    }
+}
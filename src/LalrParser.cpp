@@ -0,0 +1,30 @@
+#include "LalrParser.h"
+#include "Stats.h"
+
+LalrParser::LalrParser(TokenStream* stream) : Parser(stream) {
+}
+
+void LalrParser::parse() {
+    STATS_TIMER(Phase::Parse);
+    this->started = false;
+    this->error_message.clear();
+    // The generated parser is C and must not be unwound by an exception, so
+    // the error is only thrown once it has returned
+    if (run() != 0) {
+        error(this->error_message);
+    }
+}
+
+Token* LalrParser::nextToken() {
+    // look already holds the first token; moving only when the next one is
+    // asked for keeps the failing token in look for error()
+    if (this->started) {
+        move();
+    }
+    this->started = true;
+    return this->look;
+}
+
+void LalrParser::syntaxError(const char* message) {
+    this->error_message = message;
+}
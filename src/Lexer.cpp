@@ -1,18 +1,29 @@
 #include "Lexer.h"
+#include "Num.h"
+#include "ScannerTables.h"
+#include "Stats.h"
+#include "Str.h"
+#include "SymbolTable.h"
+#include "TokenStream.h"
+#include "Unicode.h"
+#include "Word.h"
+#include <algorithm>
 #include <cctype>
-#include <stack>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <memory>
+#include <stdexcept>
+
+Lexer::Lexer(std::pmr::memory_resource* resource)
+    : Lexer(SymbolTable::create(resource), resource) {
+}
+
+Lexer::Lexer(std::shared_ptr<SymbolTable> symbols, std::pmr::memory_resource* resource)
+    : indents(resource), symbols(std::move(symbols)), tag_tokens(this->symbols->tagTokens()),
+      rule_tokens(resource) {
 
-Lexer::Lexer(std::string filename) {
-    this->source.open(filename);
-    if (!this->source.is_open()) {
-        throw std::runtime_error("Cannot open source file: " + filename);
-    }
-    
-    // Initialize indentation stack with 0
-    this->indent_stack.push(0);
-    readch();
-    
     // Reserve keywords
     reserve(Word::And);
     reserve(Word::Or);
@@ -57,26 +68,145 @@ Lexer::Lexer(std::string filename) {
     reserve(Word("set", static_cast<int>(Tag::TYPE)));
     reserve(Word("bool", static_cast<int>(Tag::TYPE)));
 
+    // Comparison operators
+    this->op_eq = reserve(Word("==", static_cast<int>(Tag::LOGIC_OP)));
+    this->op_ne = reserve(Word("!=", static_cast<int>(Tag::LOGIC_OP)));
+    this->op_lt = reserve(Word("<", static_cast<int>(Tag::LOGIC_OP)));
+    this->op_le = reserve(Word("<=", static_cast<int>(Tag::LOGIC_OP)));
+    this->op_gt = reserve(Word(">", static_cast<int>(Tag::LOGIC_OP)));
+    this->op_ge = reserve(Word(">=", static_cast<int>(Tag::LOGIC_OP)));
+
+    resetText("");
+}
+
+Lexer::Lexer(std::string filename) : Lexer() {
+    reset(filename);
 }
 
 Lexer::~Lexer() {
-    if (this->source.is_open()) {
-        this->source.close();
+    // The Words belong to the symbol table
+}
+
+void Lexer::reset(const std::string& filename) {
+    readFile(filename, writableBuffer());
+    start(*this->buffer, 1);
+}
+
+void Lexer::readFile(const std::string& filename, std::string& contents) {
+    // Read the whole file up front, the scanner works on the buffer
+    STATS_TIMER(Phase::FileRead);
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open source file: " + filename);
+    }
+    file.seekg(0, std::ios::end);
+    std::streamoff size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    contents.resize(size > 0 ? static_cast<size_t>(size) : 0);
+    if (size > 0) {
+        file.read(&contents[0], size);
+        contents.resize(static_cast<size_t>(file.gcount()));
+    }
+    STATS_ADD(files_read, 1);
+    STATS_ADD(bytes_read, contents.size());
+}
+
+void Lexer::resetText(std::string_view text) {
+    writableBuffer().assign(text.data(), text.size());
+    start(*this->buffer, 1);
+}
+
+void Lexer::resetBuffer(std::shared_ptr<std::string> buffer) {
+    this->buffer = std::move(buffer);
+    start(*this->buffer, 1);
+}
+
+void Lexer::resetRange(std::shared_ptr<std::string> buffer, size_t begin, size_t end, int first_line) {
+    this->buffer = std::move(buffer);
+    start(std::string_view(*this->buffer).substr(begin, end - begin), first_line);
+}
+
+std::string& Lexer::writableBuffer() {
+    // Reuse the previous buffer (and its capacity) unless a stream still
+    // holds string tokens pointing into it
+    if (!this->buffer || this->buffer.use_count() > 1) {
+        this->buffer = std::make_shared<std::string>();
+    }
+    return *this->buffer;
+}
+
+void Lexer::start(std::string_view text, int first_line) {
+    this->source = text;
+    this->pos = 0;
+    this->peek = '\0';
+    this->at_end = false;
+    this->line = first_line;
+    this->first_line = first_line;
+    this->column = 0;
+    this->line_start = true;
+    this->depth = 0;
+    this->pending_dedents = 0;
+    // A UTF-8 byte order mark is not part of the text
+    if (first_line == 1 && text.substr(0, 3) == "\xEF\xBB\xBF") {
+        this->pos = 3;
+    }
+    readch();
+}
+
+void Lexer::setTabWidth(int width) {
+    if (width < 1) {
+        throw std::runtime_error("Tab width must be at least 1");
+    }
+    this->tab_width = width;
+}
+
+void Lexer::setScanner(ScannerBackend backend) {
+    this->backend = backend;
+    if (backend != ScannerBackend::Table || !this->rule_tokens.empty()) {
+        return;
+    }
+    // Literal rules that name a keyword or operator Word return it straight
+    // from the table, without a lookup per token
+    this->rule_tokens.resize(scanner::RULE_COUNT);
+    for (int i = 0; i < scanner::RULE_COUNT; i++) {
+        const scanner::Rule& rule = scanner::RULES[i];
+        if (rule.action != scanner::Action::Token) {
+            continue;
+        }
+        Word* word = rule.text ? this->symbols->find(rule.text) : nullptr;
+        this->rule_tokens[i] = word ? word : token(static_cast<Tag>(rule.tag));
     }
-    // No need to manually delete words anymore, unique_ptr handles it
 }
 
-void Lexer::reserve(Word w) {
-    this->words[w.lexeme] = std::make_unique<Word>(w.lexeme, w.tag);
+Word* Lexer::reserve(const Word& w) {
+    return this->symbols->intern(w.lexeme, w.tag);
+}
+
+Token* Lexer::token(Tag tag) {
+    return &this->tag_tokens[static_cast<int>(tag)];
 }
 
 void Lexer::readch() {
-    this->peek = this->source.get();
-    if (this->peek != EOF) {
+    if (this->pos < this->source.size()) {
+        this->peek = this->source[this->pos++];
         this->column++;
+    } else {
+        this->peek = '\0';
+        this->at_end = true;
     }
 }
 
+void Lexer::advance(std::ptrdiff_t n) {
+    // peek is the character at pos - 1, so skip n - 1 more and read the next
+    this->column += static_cast<int>(n) - 1;
+    this->pos += static_cast<size_t>(n) - 1;
+    readch();
+}
+
+char Lexer::peekNext() const {
+    return this->pos < this->source.size() ? this->source[this->pos] : '\0';
+}
+
 bool Lexer::readch(char c) {
     readch();
     if (this->peek != c) return false;
@@ -85,59 +215,34 @@ bool Lexer::readch(char c) {
 }
 
 
-void Lexer::skipWhitespace(bool at_line_start) {
-    // Skip whitespace except for newlines and indentation at the start of a line
-    this->spaces = 0;
-    while (true) {
-        if (this->peek == ' ') {
-            if (at_line_start) {
-                this->spaces++;
-            }
-            readch();
-        } else if (this->peek == '\t') {
-            if (at_line_start) {
-                this->spaces += 4; // Consider tab as 4 spaces in Python
-            }
-            readch();
-        } else if (this->peek == '\r') { // Carriage return
-            readch();
-        } else {
-            break;
-        }
+void Lexer::skipWhitespace() {
+    // Indentation was measured up front, here it is only skipped
+    while (this->peek == ' ' || this->peek == '\t' || this->peek == '\r') {
+        readch();
     }
 }
 
-Token* Lexer::handlePendingDedents() {
-    Token* t = this->dedent_queue.front();
-    this->dedent_queue.pop();
-    return t;
-}
-
-Token* Lexer::handleDedents() {
-    // Dedent (possibly multiple levels)
-    this->indent_stack.pop();
-    
-    // Create a DEDENT token
-    Token* dedent = new Token(static_cast<int>(Tag::DEDENT));
-    
-    // Check if we need multiple dedents
-    while (!this->indent_stack.empty() && this->spaces < this->indent_stack.top()) {
-        this->indent_stack.pop();
-        this->dedent_queue.push(new Token(static_cast<int>(Tag::DEDENT)));
+Token* Lexer::handleIndentation() {
+    // INDENT/DEDENT come from the difference with the depth of the
+    // previous logical line; extra DEDENTs are counted, not queued
+    const LineIndent& indent = this->indents[this->line - this->first_line];
+    if (indent.status == LineIndent::BadDedent) {
+        throw std::runtime_error("Invalid indentation at line " + std::to_string(this->line));
     }
-    
-    // Verify indentation level is valid
-    if (this->indent_stack.empty() || this->spaces != this->indent_stack.top()) {
-        throw std::runtime_error("Invalid indentation at this->line " + std::to_string(this->line));
+    if (indent.status == LineIndent::Inconsistent) {
+        throw std::runtime_error("Inconsistent use of tabs and spaces in indentation at line " +
+                                 std::to_string(this->line));
     }
-    
-    return dedent;
-}
-
-Token* Lexer::handleIdent() {
-    // Indent
-    this->indent_stack.push(this->spaces);
-    return new Token(static_cast<int>(Tag::INDENT));
+    if (indent.depth > this->depth) {
+        this->depth = indent.depth;
+        return token(Tag::INDENT);
+    }
+    if (indent.depth < this->depth) {
+        this->pending_dedents = this->depth - indent.depth - 1;
+        this->depth = indent.depth;
+        return token(Tag::DEDENT);
+    }
+    return nullptr;
 }
 
 Token* Lexer::handleNewLines() {
@@ -145,195 +250,340 @@ Token* Lexer::handleNewLines() {
     this->column = 0;
     this->line_start = true;  // Next token will be at the start of a line
     readch();
-    return new Token(static_cast<int>(Tag::NEWLINE));
+    return token(Tag::NEWLINE);
 }
 
 void Lexer::handleComments() {
     // Skip the entire comment line
-    while (this->peek != '\n' && this->peek != EOF) {
+    while (!this->at_end && this->peek != '\n') {
         readch();
     }
 }
 
 Token* Lexer::handleEOF() {
-    // Si hay tokens en la cola de DEDENTs, los procesamos primero
-    if (!this->dedent_queue.empty()) {
-        return handlePendingDedents();
-    }
-    
-    // Si el stack tiene más de un nivel, generamos un DEDENT
-    if (this->indent_stack.size() > 1) {
-        this->indent_stack.pop();
-        Token* dedent = new Token(static_cast<int>(Tag::DEDENT));
-        
-        // Guardamos los DEDENTs adicionales en la cola
-        while (this->indent_stack.size() > 1) {
-            this->indent_stack.pop();
-            this->dedent_queue.push(new Token(static_cast<int>(Tag::DEDENT)));
-        }
-        
-        return dedent;
+    // Close every open block
+    if (this->depth > 0) {
+        this->pending_dedents = this->depth - 1;
+        this->depth = 0;
+        return token(Tag::DEDENT);
     }
-    
     return nullptr;
 }
 
-Word* Lexer::findKeyword(const std::string& word) {
-    auto it = this->words.find(word);
-    if (it != this->words.end()) {
-        return it->second.get(); // Return raw pointer to the Word
+Word* Lexer::findKeyword(std::string_view word) {
+    STATS_TIMER(Phase::KeywordLookup);
+    STATS_ADD(keyword_lookups, 1);
+    Word* found = this->symbols->find(word);
+    if (found) {
+        STATS_ADD(keyword_hits, 1);
     }
-    return nullptr;
+    return found;
+}
+
+// U+XXXX, for error messages
+static std::string codePointName(char32_t cp) {
+    char name[16];
+    std::snprintf(name, sizeof(name), "U+%04X", static_cast<unsigned>(cp));
+    return name;
 }
 
 Token* Lexer::handleVariables(int tag) {
-    std::string buffer;
-    do {
-        buffer += this->peek;
-        readch();
-    } while (std::isalnum(this->peek) || this->peek == '_');
-    
+    // Scan the name straight out of the source buffer: peek is the
+    // character at pos - 1. ASCII takes one table lookup per byte, only
+    // UTF-8 sequences are decoded and looked up in the XID tables.
+    const char* begin = this->source.data() + this->pos - 1;
+    const char* end = this->source.data() + this->source.size();
+    const char* p = begin;
+    int characters = 1;
+    if (isAscii(*p)) {
+        p++;
+    } else {
+        char32_t cp;
+        int length = decodeUtf8(p, end, cp);
+        if (length == 0) {
+            throw std::runtime_error("Invalid UTF-8 at line " + std::to_string(this->line) +
+                                     ", column " + std::to_string(this->column));
+        }
+        if (!isXidStart(cp)) {
+            throw std::runtime_error("Invalid character " + codePointName(cp) + " at line " +
+                                     std::to_string(this->line) + ", column " + std::to_string(this->column));
+        }
+        p += length;
+    }
+    while (p < end) {
+        if (isAsciiIdentContinue(*p)) {
+            p++;
+        } else if (isAscii(*p)) {
+            break;
+        } else {
+            char32_t cp;
+            int length = decodeUtf8(p, end, cp);
+            if (length == 0 || !isXidContinue(cp)) {
+                break;
+            }
+            p += length;
+        }
+        characters++;
+    }
+
+    // Known identifiers are looked up by a view of the source and never allocate
+    std::string_view name(begin, static_cast<size_t>(p - begin));
+    advance(p - begin);
+    // Columns count characters, not bytes
+    this->column -= static_cast<int>(p - begin) - characters;
+    return word(name, tag);
+}
+
+Token* Lexer::word(std::string_view name, int tag) {
     // Check if identifier is a keyword
-    if (Word* word = findKeyword(buffer)) {
+    if (Word* word = findKeyword(name)) {
         return word;
     }
 
     // Not a keyword, so create a new identifier token
-    auto w = std::make_unique<Word>(buffer, tag);
-    Word* raw_ptr = w.get();
-    this->words[buffer] = std::move(w);
-    return raw_ptr;
+    STATS_ADD(word_inserts, 1);
+    return this->symbols->intern(name, tag);
+}
+
+static bool isDigitOf(char c, int base) {
+    switch (base) {
+    case 2:  return c == '0' || c == '1';
+    case 8:  return c >= '0' && c <= '7';
+    case 16: return std::isxdigit(static_cast<unsigned char>(c)) != 0;
+    default: return std::isdigit(static_cast<unsigned char>(c)) != 0;
+    }
+}
+
+// Copies the digits of [begin, end) without the '_' separators into out,
+// checking that every '_' sits between two digits. Returns the number of
+// characters written, -1 if a separator is misplaced or -2 if out is too small.
+static int stripSeparators(const char* begin, const char* end, int base, char* out, int capacity) {
+    int n = 0;
+    for (const char* p = begin; p < end; p++) {
+        if (*p == '_') {
+            bool between_digits = p > begin && p + 1 < end &&
+                                  isDigitOf(p[-1], base) && isDigitOf(p[1], base);
+            if (!between_digits) {
+                return -1;
+            }
+            continue;
+        }
+        if (n == capacity) {
+            return -2;
+        }
+        out[n++] = *p;
+    }
+    return n;
 }
 
 Token* Lexer::handleNumbers() {
-    int value = 0;
-    do {
-        value = 10 * value + (this->peek - '0');
-        readch();
-    } while (std::isdigit(this->peek));
-    
-    // Check for float
-    if (this->peek == '.') {
-        std::string float_str = std::to_string(value) + ".";
-        readch();
-        
-        // Parse decimal part
-        if (std::isdigit(this->peek)) {
-            do {
-                float_str += this->peek;
-                readch();
-            } while (std::isdigit(this->peek));
-            
-            // In a full implementation, you'd want to create a Real or Float token
-            return new Num(std::stoi(float_str));
+    // Scan the literal straight out of the source buffer: peek is the
+    // character at pos - 1
+    const char* begin = this->source.data() + this->pos - 1;
+    const char* end = this->source.data() + this->source.size();
+    const char* p = begin;
+    int base = 10;
+    bool is_float = false;
+
+    auto digits = [&](int b) {
+        while (p < end && (isDigitOf(*p, b) || *p == '_')) {
+            p++;
+        }
+    };
+
+    if (p + 1 < end && p[0] == '0' && (p[1] == 'x' || p[1] == 'X' ||
+                                       p[1] == 'o' || p[1] == 'O' ||
+                                       p[1] == 'b' || p[1] == 'B')) {
+        char prefix = static_cast<char>(p[1] | 0x20);
+        base = prefix == 'x' ? 16 : (prefix == 'o' ? 8 : 2);
+        p += 2;
+        // Python allows a separator right after the prefix: 0x_ff
+        if (p < end && *p == '_') {
+            p++;
+        }
+        digits(base);
+    } else {
+        digits(10);
+        if (p < end && *p == '.') {
+            is_float = true;
+            p++;
+            digits(10);
+        }
+        if (p < end && (*p == 'e' || *p == 'E')) {
+            const char* exponent = p + 1;
+            if (exponent < end && (*exponent == '+' || *exponent == '-')) {
+                exponent++;
+            }
+            if (exponent < end && std::isdigit(static_cast<unsigned char>(*exponent))) {
+                is_float = true;
+                p = exponent;
+                digits(10);
+            }
         }
     }
-    
-    return new Num(value);
+    const char* literal_end = p;
+    bool imaginary = false;
+    if (p < end && (*p == 'j' || *p == 'J') && base == 10) {
+        imaginary = true;
+        p++;
+    }
+    Num* num = makeNumber(begin, literal_end, base, is_float, imaginary);
+
+    // Letters right after a literal (123abc, 0b12, 1é) are not a valid number
+    if (p < end && (isAsciiIdentContinue(*p) || !isAscii(*p))) {
+        throw std::runtime_error("Invalid numeric literal at line " + std::to_string(this->line) +
+                                 ", column " + std::to_string(this->column));
+    }
+
+    advance(p - begin);
+    return num;
 }
 
-Token* Lexer::handleStrings() {
-    char quote = this->peek;
-    std::string str;
-    std::string quoteBuffer;
-    
-    // Read opening quotes into buffer
-    while (this->peek == quote && quoteBuffer.length() < 3) {
-        quoteBuffer += this->peek;
-        readch();
+Num* Lexer::makeNumber(const char* begin, const char* literal_end, int base, bool is_float, bool imaginary) {
+    const char* end = this->source.data() + this->source.size();
+    // Digits start after the radix prefix and its optional separator
+    const char* digits_begin = begin;
+    if (base != 10) {
+        digits_begin += (begin + 2 < end && begin[2] == '_') ? 3 : 2;
     }
-    
-    bool isDocString = (quoteBuffer.length() == 3);
-    
-    // If it's not a docstring, add the quotes to the string
-    if (!isDocString) {
-        str = quoteBuffer;
+    // Literals only get copied to drop separators, into a stack buffer that
+    // keeps room for a terminator. Only huge literals need the heap.
+    char stack_buffer[128];
+    std::string heap_buffer;
+    char* buffer = stack_buffer;
+    int length = stripSeparators(digits_begin, literal_end, base, buffer, sizeof(stack_buffer) - 1);
+    if (length == -2) {
+        heap_buffer.resize(static_cast<size_t>(literal_end - digits_begin) + 1);
+        buffer = &heap_buffer[0];
+        length = stripSeparators(digits_begin, literal_end, base, buffer,
+                                 static_cast<int>(heap_buffer.size()) - 1);
     }
-    
-    while (true) {
-        if (isDocString) {
-            // For docstrings, check for triple quotes to end
-            if (this->peek == quote) {
-                quoteBuffer.clear();
-                while (this->peek == quote && quoteBuffer.length() < 3) {
-                    quoteBuffer += this->peek;
-                    readch();
-                }
-                
-                if (quoteBuffer.length() == 3) {
-                    break;
-                }
-                
-                // Not enough quotes, add them to the string
-                str += quoteBuffer;
-                continue;
+    if (length <= 0) {
+        throw std::runtime_error("Invalid numeric literal at line " + std::to_string(this->line) +
+                                 ", column " + std::to_string(this->column));
+    }
+
+    Num* num = nullptr;
+    if (is_float || imaginary) {
+        double value = 0.0;
+        auto result = std::from_chars(buffer, buffer + length, value);
+        if (result.ec == std::errc::invalid_argument || result.ptr != buffer + length) {
+            throw std::runtime_error("Invalid numeric literal at line " + std::to_string(this->line));
+        }
+        if (result.ec == std::errc::result_out_of_range) {
+            // from_chars leaves value untouched, strtod gives inf/0 like Python
+            buffer[length] = '\0';
+            value = std::strtod(buffer, nullptr);
+        }
+        num = this->output->make<Num>(value, imaginary ? Num::Kind::Imaginary : Num::Kind::Float);
+    } else {
+        long long value = 0;
+        auto result = std::from_chars(buffer, buffer + length, value, base);
+        if (result.ptr != buffer + length && result.ec != std::errc::result_out_of_range) {
+            throw std::runtime_error("Invalid numeric literal at line " + std::to_string(this->line));
+        }
+        num = this->output->make<Num>(value);
+        if (result.ec == std::errc::result_out_of_range) {
+            // Python ints are unbounded, keep an approximation of the value
+            num->big = true;
+            num->real = 0.0;
+            for (int i = 0; i < length; i++) {
+                int digit = std::isdigit(static_cast<unsigned char>(buffer[i]))
+                            ? buffer[i] - '0'
+                            : (buffer[i] | 0x20) - 'a' + 10;
+                num->real = num->real * base + digit;
             }
-        } else if (this->peek == quote) {
-            readch(); // Consume the closing quote for normal strings
-            break;
         }
-        
-        if (this->peek == EOF || (!isDocString && this->peek == '\n')) {
-            throw std::runtime_error("Unterminated " + std::string(isDocString ? "docstring" : "string") + 
+    }
+    return num;
+}
+
+Token* Lexer::handleStrings() {
+    // Find the end of the literal in the source buffer; the token keeps a
+    // view of the text between the quotes and unescapes only on demand
+    const char* begin = this->source.data() + this->pos - 1;
+    const char* end = this->source.data() + this->source.size();
+    char quote = *begin;
+    const char* p = begin + 1;
+
+    bool isDocString = (p + 1 < end && p[0] == quote && p[1] == quote);
+    if (!isDocString && p < end && *p == quote) {
+        // Empty string
+        advance(p + 1 - begin);
+        return this->output->make<Str>(std::string_view(p, 0), static_cast<int>(Tag::STRING));
+    }
+    if (isDocString) {
+        p += 2;
+    }
+
+    const char* content = p;
+    const char* line_begin = nullptr;  // Start of the last line inside the literal
+    while (true) {
+        if (p >= end || (!isDocString && *p == '\n')) {
+            throw std::runtime_error("Unterminated " + std::string(isDocString ? "docstring" : "string") +
                                    " at line " + std::to_string(this->line));
         }
-        
-        if (this->peek == '\\') {
-            readch(); // Skip escape character
-            switch (this->peek) {
-                case 'n': str += '\n'; break;
-                case 't': str += '\t'; break;
-                case 'r': str += '\r'; break;
-                case '\\': str += '\\'; break;
-                case '\'': str += '\''; break;
-                case '\"': str += '\"'; break;
-                default: str += this->peek;
+        if (*p == '\\') {
+            // The escaped character never closes the literal
+            p++;
+            if (p >= end) {
+                continue;
+            }
+        } else if (*p == quote) {
+            if (!isDocString) {
+                break;
+            }
+            if (p + 2 < end && p[1] == quote && p[2] == quote) {
+                break;
             }
-        } else {
-            str += this->peek;
         }
-        readch();
+        if (*p == '\n') {
+            this->line++;
+            line_begin = p + 1;
+        }
+        p++;
     }
-    
-    auto w = std::make_unique<Word>(str, static_cast<int>(isDocString ? Tag::DOCSTRING : Tag::STRING));
-    Word* raw_ptr = w.get();
-    this->words[str] = std::move(w);
-    return raw_ptr;
+
+    std::string_view raw(content, static_cast<size_t>(p - content));
+    p += isDocString ? 3 : 1;
+    advance(p - begin);
+    if (line_begin) {
+        this->column = static_cast<int>(p - line_begin);
+    }
+    return this->output->make<Str>(raw, static_cast<int>(isDocString ? Tag::DOCSTRING : Tag::STRING));
 }
 
 Token* Lexer::handleOperators() {
     Token* t = nullptr;
     switch (this->peek) {
     case '+':
-        t = new Token(static_cast<int>(Tag::PLUS));
+        t = token(Tag::PLUS);
         break;
     case '-':
         readch();
         if (this->peek == '>') {
-            readch();
-            t = new Token(static_cast<int>(Tag::ARROW));
+            t = token(Tag::ARROW);
         } else {
-            t = new Token(static_cast<int>(Tag::MINUS));
+            t = token(Tag::MINUS);
             // Don't readch() again as we already did above
             return t;
         }
         break;
     case '*':
-        t = new Token(static_cast<int>(Tag::MULT));
+        t = token(Tag::MULT);
         break;
     case '/':
-        t = new Token(static_cast<int>(Tag::DIV));
+        t = token(Tag::DIV);
         break;
     case '%':
-        t = new Token(static_cast<int>(Tag::MOD));
+        t = token(Tag::MOD);
         break;
     case '=':
         readch();
         if (this->peek == '=') {
-            readch();
-            t = new Word("==", static_cast<int>(Tag::LOGIC_OP));
+            t = this->op_eq;
         } else {
-            t = new Token(static_cast<int>(Tag::ASSIGN));
+            t = token(Tag::ASSIGN);
             // Don't readch() again as we already did above
             return t;
         }
@@ -341,8 +591,7 @@ Token* Lexer::handleOperators() {
     case '!':
         readch();
         if (this->peek == '=') {
-            readch();
-            t = new Word("!=", static_cast<int>(Tag::LOGIC_OP));
+            t = this->op_ne;
         } else {
             throw std::runtime_error("Unrecognized character: ! at line " + std::to_string(this->line));
         }
@@ -350,10 +599,9 @@ Token* Lexer::handleOperators() {
     case '<':
         readch();
         if (this->peek == '=') {
-            readch();
-            t = new Word("<=", static_cast<int>(Tag::LOGIC_OP));
+            t = this->op_le;
         } else {
-            t = new Word("<", static_cast<int>(Tag::LOGIC_OP));
+            t = this->op_lt;
             // Don't readch() again as we already did above
             return t;
         }
@@ -361,10 +609,9 @@ Token* Lexer::handleOperators() {
     case '>':
         readch();
         if (this->peek == '=') {
-            readch();
-            t = new Word(">=", static_cast<int>(Tag::LOGIC_OP));
+            t = this->op_ge;
         } else {
-            t = new Word(">", static_cast<int>(Tag::LOGIC_OP));
+            t = this->op_gt;
             // Don't readch() again as we already did above
             return t;
         }
@@ -373,6 +620,7 @@ Token* Lexer::handleOperators() {
         return nullptr;
     }
     
+    // Consumes the last character of the operator
     readch();
     return t;
 }
@@ -382,31 +630,31 @@ Token* Lexer::handlePunctuation() {
     Token* t = nullptr;
     switch (this->peek) {
     case ':':
-        t = new Token(static_cast<int>(Tag::COLON));
+        t = token(Tag::COLON);
         break;
     case ',':
-        t = new Token(static_cast<int>(Tag::COMMA));
+        t = token(Tag::COMMA);
         break;
     case '.':
-        t = new Token(static_cast<int>(Tag::DOT));
+        t = token(Tag::DOT);
         break;
     case '(':
-        t = new Token(static_cast<int>(Tag::OPEN_PARENTHESIS));
+        t = token(Tag::OPEN_PARENTHESIS);
         break;
     case ')':
-        t = new Token(static_cast<int>(Tag::CLOSE_PARENTHESIS));
+        t = token(Tag::CLOSE_PARENTHESIS);
         break;
     case '[':
-        t = new Token(static_cast<int>(Tag::OPEN_BRACKET));
+        t = token(Tag::OPEN_BRACKET);
         break;
     case ']':
-        t = new Token(static_cast<int>(Tag::CLOSE_BRACKET));
+        t = token(Tag::CLOSE_BRACKET);
         break;
     case '{':
-        t = new Token(static_cast<int>(Tag::OPEN_BRACE));
+        t = token(Tag::OPEN_BRACE);
         break;
     case '}':
-        t = new Token(static_cast<int>(Tag::CLOSE_BRACE));
+        t = token(Tag::CLOSE_BRACE);
         break;
     default:
         return nullptr;
@@ -418,25 +666,21 @@ Token* Lexer::handlePunctuation() {
 
 Token* Lexer::scan() {
     // Handle any pending dedents
-    if (!this->dedent_queue.empty()) {
-        return handlePendingDedents();
+    if (this->pending_dedents > 0) {
+        this->pending_dedents--;
+        return token(Tag::DEDENT);
     }
     
     bool at_line_start = this->line_start;
-    skipWhitespace(at_line_start);
+    skipWhitespace();
     // Reset line_start flag now that we've processed any indentation
     this->line_start = false;
     
     // Handle indentation
-    if (at_line_start && this->peek != '\n' && this->peek != '#' && this->peek != EOF) {
-        int current_indent = this->indent_stack.top();
-    
-        if (this->spaces > current_indent) {
-            return handleIdent();
-        } else if (this->spaces < current_indent) {
-            return handleDedents();
+    if (at_line_start && this->peek != '\n' && this->peek != '#' && !this->at_end) {
+        if (Token* t = handleIndentation()) {
+            return t;
         }
-        // If spaces == current_indent, no indentation token needed
     }
     
     // Handle comments
@@ -451,7 +695,7 @@ Token* Lexer::scan() {
     }
     
     // Handle EOF
-    if (this->peek == EOF) {
+    if (this->at_end) {
         return handleEOF();
     }
     
@@ -460,13 +704,14 @@ Token* Lexer::scan() {
         return handleVariables(static_cast<int>(Tag::DECORATOR));
     }
     
-    // Handle identifiers and keywords
-    if (std::isalpha(this->peek) || this->peek == '_') {
+    // Handle identifiers and keywords, which may be non-ASCII (PEP 3131)
+    if (isAsciiIdentStart(this->peek) || !isAscii(this->peek)) {
         return handleVariables(static_cast<int>(Tag::VARIABLE));
     }
     
-    // Handle numbers
-    if (std::isdigit(this->peek)) {
+    // Handle numbers, including floats written as .5
+    if (std::isdigit(static_cast<unsigned char>(this->peek)) ||
+        (this->peek == '.' && std::isdigit(static_cast<unsigned char>(peekNext())))) {
         return handleNumbers();
     }
     
@@ -486,19 +731,148 @@ Token* Lexer::scan() {
     
 }
 
+Token* Lexer::scanTable() {
+    // Same layout handling as scan(), but every token (whitespace and
+    // comments included) is recognized by the generated DFA, which finds
+    // the longest match from the current character in one pass
+    if (this->pending_dedents > 0) {
+        this->pending_dedents--;
+        return token(Tag::DEDENT);
+    }
+
+    while (true) {
+        if (this->at_end) {
+            return handleEOF();
+        }
+        const char* begin = this->source.data() + this->pos - 1;
+        const char* end = this->source.data() + this->source.size();
+        const char* match_end;
+        int rule = scanner::match(begin, end, match_end);
+        scanner::Action action = rule >= 0 ? scanner::RULES[rule].action : scanner::Action::Error;
+
+        // Indentation is checked before the first token of a line
+        if (this->line_start && action != scanner::Action::Skip) {
+            this->line_start = false;
+            if (action != scanner::Action::Newline) {
+                if (Token* t = handleIndentation()) {
+                    return t;
+                }
+            }
+        }
+
+        switch (action) {
+        case scanner::Action::Skip:
+            advance(match_end - begin);
+            continue;
+        case scanner::Action::Newline:
+            return handleNewLines();
+        case scanner::Action::Error:
+            if (rule >= 0) {
+                // Unterminated literals, reported at the line they run to
+                this->line += static_cast<int>(std::count(begin, match_end, '\n'));
+                throw std::runtime_error(std::string(scanner::RULES[rule].text) + " at line " +
+                                         std::to_string(this->line));
+            }
+            // Non-ASCII text starts an identifier, the XID tables decide
+            if (!isAscii(this->peek)) {
+                return handleVariables(static_cast<int>(Tag::VARIABLE));
+            }
+            throw std::runtime_error("Unrecognized character: " + std::string(1, this->peek) +
+                                     " at line " + std::to_string(this->line) +
+                                     ", column " + std::to_string(this->column));
+        case scanner::Action::Token:
+            break;
+        }
+
+        int tag = scanner::RULES[rule].tag;
+        size_t length = static_cast<size_t>(match_end - begin);
+        bool runs_to_end = match_end == end;
+        // Names (and keywords) that go on with non-ASCII characters are
+        // left to the Unicode-aware path
+        if (!runs_to_end && !isAscii(*match_end) && (isAsciiIdentContinue(*begin) || *begin == '@') &&
+            tag != static_cast<int>(Tag::NUM)) {
+            return handleVariables(*begin == '@' ? static_cast<int>(Tag::DECORATOR)
+                                                 : static_cast<int>(Tag::VARIABLE));
+        }
+
+        if (tag == static_cast<int>(Tag::VARIABLE) || tag == static_cast<int>(Tag::DECORATOR)) {
+            advance(match_end - begin);
+            return word(std::string_view(begin, length), tag);
+        }
+        if (tag == static_cast<int>(Tag::NUM)) {
+            int base = 10;
+            char prefix = length > 1 && begin[0] == '0' ? static_cast<char>(begin[1] | 0x20) : '\0';
+            if (prefix == 'x' || prefix == 'o' || prefix == 'b') {
+                base = prefix == 'x' ? 16 : (prefix == 'o' ? 8 : 2);
+            }
+            bool imaginary = base == 10 && (match_end[-1] | 0x20) == 'j';
+            const char* literal_end = imaginary ? match_end - 1 : match_end;
+            bool is_float = base == 10 && std::find_if(begin, literal_end, [](char c) {
+                return c == '.' || c == 'e' || c == 'E';
+            }) != literal_end;
+            Num* num = makeNumber(begin, literal_end, base, is_float, imaginary);
+            // Letters right after a literal (123abc, 0b12, 1é) are not a valid number
+            if (!runs_to_end && (isAsciiIdentContinue(*match_end) || !isAscii(*match_end))) {
+                throw std::runtime_error("Invalid numeric literal at line " + std::to_string(this->line) +
+                                         ", column " + std::to_string(this->column));
+            }
+            advance(match_end - begin);
+            return num;
+        }
+        if (tag == static_cast<int>(Tag::STRING) || tag == static_cast<int>(Tag::DOCSTRING)) {
+            size_t quotes = tag == static_cast<int>(Tag::DOCSTRING) ? 3 : 1;
+            std::string_view raw(begin + quotes, length - 2 * quotes);
+            advance(match_end - begin);
+            // Docstrings and escaped newlines move to a later line
+            const char* line_begin = nullptr;
+            for (const char* p = begin; p < match_end; p++) {
+                if (*p == '\n') {
+                    this->line++;
+                    line_begin = p + 1;
+                }
+            }
+            if (line_begin) {
+                this->column = static_cast<int>(match_end - line_begin);
+            }
+            return this->output->make<Str>(raw, tag);
+        }
+        advance(match_end - begin);
+        return this->rule_tokens[rule];
+    }
+}
+
 TokenStream* Lexer::generateStream() {
-    TokenStream* stream = new TokenStream();
-        
-    // Generate all tokens
+    // Not leaked if lexing throws
+    auto stream = std::make_unique<TokenStream>();
+    generateStream(*stream);
+    return stream.release();
+}
+
+void Lexer::generateStream(TokenStream& stream) {
+    stream.clear();
+    {
+        STATS_TIMER(Phase::Indentation);
+        measureIndentation(this->source, this->tab_width, this->check_tabs, this->indents);
+    }
+
+    // Generate all tokens. Literals are made per occurrence in the stream,
+    // every other token is shared and stays owned by the lexer.
+    STATS_TIMER(Phase::Scan);
+    this->output = &stream;
     while (true) {
-        Token* token = scan();
+        Token* token = this->backend == ScannerBackend::Table ? scanTable() : scan();
         if (token == nullptr) {
             break;  // End of file
         }
-        stream->addToken(token);
+        STATS_TOKEN(token->tag);
+        stream.add(token);
     }
+    this->output = nullptr;
+    // String tokens point into the source buffer, the others into the
+    // symbol table
+    stream.retain(this->buffer);
+    stream.retain(this->symbols);
     
     // Reset stream position
-    stream->reset();
-    return stream;
+    stream.reset();
 }
\ No newline at end of file
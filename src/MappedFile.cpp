@@ -0,0 +1,49 @@
+#include "MappedFile.h"
+#include <stdexcept>
+
+#ifdef _WIN32
+#include "Lexer.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(const std::string& filename) {
+#ifndef _WIN32
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file " + filename);
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw std::runtime_error("Could not stat file " + filename);
+    }
+    this->length = static_cast<size_t>(info.st_size);
+    if (this->length > 0) {
+        void* address = mmap(nullptr, this->length, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (address == MAP_FAILED) {
+            throw std::runtime_error("Could not map file " + filename);
+        }
+        this->bytes = static_cast<const char*>(address);
+        this->mapped = true;
+        return;
+    }
+    close(fd);
+#else
+    Lexer::readFile(filename, this->fallback);
+#endif
+    this->bytes = this->fallback.data();
+    this->length = this->fallback.size();
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+    if (this->mapped) {
+        munmap(const_cast<char*>(this->bytes), this->length);
+    }
+#endif
+}
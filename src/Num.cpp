@@ -1,9 +1,21 @@
 #include "Num.h"
 
-Num::Num(int v) : Token(static_cast<int>(Tag::NUM)) {
+Num::Num(long long v) : Token(static_cast<int>(Tag::NUM)) {
     this->value = v;
 }
 
+Num::Num(double v, Kind kind) : Token(static_cast<int>(Tag::NUM)) {
+    this->kind = kind;
+    this->real = v;
+}
+
 std::string Num::toString() {
-    return std::to_string(value);
+    if (this->kind == Kind::Int && !this->big) {
+        return std::to_string(value);
+    }
+    std::string s = std::to_string(real);
+    if (this->kind == Kind::Imaginary) {
+        s += "j";
+    }
+    return s;
 }
\ No newline at end of file
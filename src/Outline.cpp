@@ -0,0 +1,25 @@
+#include "Outline.h"
+
+void adoptTypes(std::vector<MethodInfo>& methods, TypeTable& table) {
+    for (MethodInfo& method : methods) {
+        for (ParamInfo& param : method.params) {
+            if (param.type) {
+                param.type = table.adopt(param.type);
+            }
+        }
+        if (method.return_type) {
+            method.return_type = table.adopt(method.return_type);
+        }
+    }
+}
+
+void adoptTypes(Outline& outline, const std::shared_ptr<TypeTable>& table) {
+    if (!outline.types || outline.types == table) {
+        return;
+    }
+    for (ClassInfo& cls : outline.classes) {
+        adoptTypes(cls.methods, *table);
+    }
+    adoptTypes(outline.functions, *table);
+    outline.types = table;
+}
@@ -0,0 +1,110 @@
+#include "ParallelLexer.h"
+#include "Indentation.h"
+#include "Unicode.h"
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+namespace {
+
+bool isIdentChar(char c) {
+    // Any non-ASCII byte may be part of an identifier
+    return isAsciiIdentContinue(c) || !isAscii(c);
+}
+
+bool startsWithWord(std::string_view source, size_t i, std::string_view word) {
+    return source.compare(i, word.size(), word) == 0 &&
+           (i + word.size() == source.size() || !isIdentChar(source[i + word.size()]));
+}
+
+bool startsTopLevel(std::string_view source, size_t i) {
+    return source[i] == '@' || startsWithWord(source, i, "class") || startsWithWord(source, i, "def");
+}
+
+}
+
+std::vector<SplitPoint> findSplitPoints(std::string_view source) {
+    std::vector<SplitPoint> points;
+    forEachLineStart(source, [&](size_t i, int line) {
+        if (i > 0 && i < source.size() && startsTopLevel(source, i)) {
+            points.push_back({i, line});
+        }
+    });
+    return points;
+}
+
+ParallelLexer::ParallelLexer(const std::string& filename, unsigned threads)
+    : buffer(std::make_shared<std::string>()), threads(threads) {
+    if (this->threads == 0) {
+        this->threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    Lexer::readFile(filename, *this->buffer);
+}
+
+TokenStream* ParallelLexer::generateStream() {
+    // Not leaked if lexing throws
+    auto stream = std::make_unique<TokenStream>();
+    generateStream(*stream);
+    return stream.release();
+}
+
+void ParallelLexer::generateStream(TokenStream& stream) {
+    const std::string& source = *this->buffer;
+
+    // Group the split points into chunks of roughly equal size
+    std::vector<SplitPoint> cuts = {{0, 1}};
+    size_t target = std::max(MIN_CHUNK_BYTES, source.size() / this->threads);
+    if (this->threads > 1 && source.size() >= 2 * MIN_CHUNK_BYTES) {
+        for (const SplitPoint& point : findSplitPoints(source)) {
+            if (point.offset - cuts.back().offset >= target) {
+                cuts.push_back(point);
+            }
+        }
+    }
+    cuts.push_back({source.size(), 0});
+
+    this->chunks = cuts.size() - 1;
+    // Lexers are kept across calls, their symbol tables are already warm
+    if (this->lexers.size() < chunks) {
+        this->lexers.resize(chunks);
+    }
+    std::vector<TokenStream> streams(chunks);
+    std::vector<std::exception_ptr> errors(chunks);
+
+    auto lexChunk = [&](size_t k) {
+        try {
+            if (!this->lexers[k]) {
+                this->lexers[k] = std::make_unique<Lexer>();
+            }
+            this->lexers[k]->setTabWidth(this->tab_width);
+            this->lexers[k]->setTabCheck(this->check_tabs);
+            this->lexers[k]->setScanner(this->backend);
+            this->lexers[k]->resetRange(this->buffer, cuts[k].offset, cuts[k + 1].offset, cuts[k].line);
+            this->lexers[k]->generateStream(streams[k]);
+        } catch (...) {
+            errors[k] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t k = 1; k < chunks; k++) {
+        workers.emplace_back(lexChunk, k);
+    }
+    lexChunk(0);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    // The first error in file order is the one the sequential lexer hits
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    stream.clear();
+    for (TokenStream& chunk : streams) {
+        stream.append(std::move(chunk));
+    }
+    stream.reset();
+}
@@ -1,8 +1,17 @@
 #include "Parser.h"
-#include "Lexer.h"
+#include <iostream>
+#include <stdexcept>
 
-Parser::Parser(TokenStream* stream) : stream(stream) {
-    move(); // Get the first token
+Parser::Parser(TokenStream* stream) : stream(stream), look(nullptr) {
+    if (stream) {
+        move(); // Get the first token
+    }
+}
+
+void Parser::reset(TokenStream* stream) {
+    this->stream = stream;
+    this->stream->reset();
+    move();
 }
 
 void Parser::move() {
@@ -28,5 +37,5 @@ bool Parser::isType(int tag) {
 }
 
 void Parser::debug(const std::string& message) {
-    std::cout << "Non-terminal in use: " << message << std::endl;
+    std::cout << "Non-terminal in use: " << message << '\n';
 }
\ No newline at end of file
@@ -0,0 +1,294 @@
+#include "Project.h"
+#include "Lexer.h"
+#include "RecursiveDescendant.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+void Project::addRoot(const std::string& root) {
+    namespace fs = std::filesystem;
+    std::vector<fs::path> files;
+    fs::path base(root);
+    if (fs::is_directory(base)) {
+        for (const auto& entry : fs::recursive_directory_iterator(base, fs::directory_options::skip_permission_denied)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".py") {
+                files.push_back(entry.path());
+            }
+        }
+        // Same module numbers for the same tree, whatever the directory order
+        std::sort(files.begin(), files.end());
+    } else {
+        files.push_back(base);
+    }
+
+    for (const fs::path& file : files) {
+        Module module;
+        module.path = file.string();
+        fs::path relative = file == base ? file.filename() : file.lexically_relative(base);
+        relative.replace_extension();
+        for (const fs::path& part : relative) {
+            if (!module.name.empty()) {
+                module.name += '.';
+            }
+            module.name += part.string();
+        }
+        if (relative.filename() == "__init__") {
+            module.package = true;
+            size_t dot = module.name.rfind('.');
+            module.name.resize(dot == std::string::npos ? 0 : dot);
+        }
+        // A name given twice (by two roots) refers to the first module
+        this->names.emplace(module.name, static_cast<uint32_t>(this->all.size()));
+        this->all.push_back(std::move(module));
+    }
+}
+
+int64_t Project::find(const std::string& name) const {
+    auto it = this->names.find(name);
+    return it == this->names.end() ? -1 : static_cast<int64_t>(it->second);
+}
+
+void Project::analyze(unsigned threads, FileLoader::Backend io) {
+    size_t n = this->all.size();
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(1, n)));
+    this->finished.clear();
+    this->tables.assign(n, {});
+    this->exports.assign(n, {});
+
+    struct State {
+        int waiting = 1;        // Imports not checked yet, plus the module's own parse
+        bool queued = false;    // Its check is ready, running or done
+        bool checked = false;
+        std::vector<uint32_t> dependents;  // Modules whose checks wait for this one
+    };
+    struct Task {
+        uint32_t module;
+        bool check;             // Else parse
+    };
+    std::vector<State> states(n);
+    // Parse tasks take whichever file is read first, so their module is
+    // only known once they run
+    std::deque<Task> ready(n, Task{0, false});
+    size_t running = 0;
+    size_t unchecked = n;
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::vector<std::string> paths;
+    for (const Module& module : this->all) {
+        paths.push_back(module.path);
+    }
+    FileLoader loader(std::move(paths), io);
+    // Parsers fill a table of their own and move the hints into the one of
+    // the project as each file is done, the only time they take its lock
+    std::shared_ptr<TypeTable> types = std::make_shared<TypeTable>();
+    std::mutex types_mutex;
+
+    auto release = [&](uint32_t id) {
+        State& state = states[id];
+        if (state.waiting == 0 && !state.queued) {
+            state.queued = true;
+            ready.push_back({id, true});
+        }
+    };
+
+    // Each worker reuses one lexer, stream, parser and analyzer for all its
+    // modules
+    auto work = [&]() {
+        Lexer lexer;
+        TokenStream stream;
+        RecursiveDescendant parser(nullptr);
+        SemanticAnalyzer analyzer;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            changed.wait(lock, [&]() { return unchecked == 0 || !ready.empty() || running == 0; });
+            if (unchecked == 0) {
+                return;
+            }
+            if (ready.empty()) {
+                // Everything is parsed and every module left waits on an
+                // import cycle: check the first one with what is known
+                for (uint32_t i = 0; i < n; i++) {
+                    if (!states[i].queued) {
+                        states[i].queued = true;
+                        ready.push_back({i, true});
+                        break;
+                    }
+                }
+            }
+            Task task = ready.front();
+            ready.pop_front();
+            running++;
+            std::vector<uint32_t> checked;
+            if (task.check) {
+                for (uint32_t dependency : this->all[task.module].imports) {
+                    if (states[dependency].checked) {
+                        checked.push_back(dependency);
+                    }
+                }
+            }
+            lock.unlock();
+
+            if (task.check) {
+                check(task.module, checked, analyzer);
+            } else {
+                FileLoader::File file;
+                loader.next(file);
+                task.module = static_cast<uint32_t>(file.index);
+                Module& module = this->all[task.module];
+                bool lexed = false;
+                try {
+                    if (!file.error.empty()) {
+                        throw std::runtime_error(file.error);
+                    }
+                    lexer.resetBuffer(std::move(file.contents));
+                    lexer.generateStream(stream);
+                    lexed = true;
+                    parser.reset(&stream);
+                    parser.parse();
+                } catch (const std::runtime_error& e) {
+                    module.error = e.what();
+                }
+                // A file that failed to read or lex has no outline
+                if (lexed) {
+                    module.outline = parser.outline();
+                    std::lock_guard<std::mutex> guard(types_mutex);
+                    adoptTypes(module.outline, types);
+                }
+                resolveImports(task.module);
+            }
+
+            lock.lock();
+            running--;
+            Module& module = this->all[task.module];
+            State& state = states[task.module];
+            if (task.check) {
+                state.checked = true;
+                unchecked--;
+                this->finished.push_back(task.module);
+                for (uint32_t dependent : state.dependents) {
+                    states[dependent].waiting--;
+                    release(dependent);
+                }
+                state.dependents.clear();
+            } else {
+                for (uint32_t dependency : module.imports) {
+                    if (!states[dependency].checked) {
+                        states[dependency].dependents.push_back(task.module);
+                        state.waiting++;
+                    }
+                }
+                state.waiting--;
+                release(task.module);
+            }
+            changed.notify_all();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; t++) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+// Absolute dotted name of the module an import refers to; false for a
+// relative import that goes above the root
+bool Project::target(uint32_t id, const ImportInfo& import, std::string& name) const {
+    if (import.level == 0) {
+        name = import.module;
+        return true;
+    }
+    const Module& module = this->all[id];
+    name = module.name;
+    // One dot is the package of the module: its parent, or itself for a
+    // package. Every other dot goes up one more.
+    for (int level = module.package ? 1 : 0; level < import.level; level++) {
+        if (name.empty()) {
+            return false;
+        }
+        size_t dot = name.rfind('.');
+        name.resize(dot == std::string::npos ? 0 : dot);
+    }
+    if (!import.module.empty()) {
+        name += name.empty() ? import.module : "." + import.module;
+    }
+    return true;
+}
+
+void Project::resolveImports(uint32_t id) {
+    Module& module = this->all[id];
+    module.imports.clear();
+    auto add = [&](const std::string& name) {
+        int64_t found = find(name);
+        if (found >= 0 && found != id) {
+            module.imports.push_back(static_cast<uint32_t>(found));
+        }
+    };
+    for (const ImportInfo& import : module.outline.imports) {
+        std::string name;
+        if (!target(id, import, name)) {
+            continue;
+        }
+        add(name);
+        // from package import module
+        for (const auto& imported : import.names) {
+            if (imported.first != "*") {
+                add(name.empty() ? imported.first : name + "." + imported.first);
+            }
+        }
+    }
+    std::sort(module.imports.begin(), module.imports.end());
+    module.imports.erase(std::unique(module.imports.begin(), module.imports.end()), module.imports.end());
+}
+
+// Runs the checks of a module with the classes it imports from the checked
+// modules (a sorted subset of its imports) in view
+void Project::check(uint32_t id, const std::vector<uint32_t>& checked, SemanticAnalyzer& analyzer) {
+    Module& module = this->all[id];
+    SemanticAnalyzer::ImportedClasses imported;
+    for (const ImportInfo& import : module.outline.imports) {
+        std::string name;
+        if (import.names.empty() || !target(id, import, name)) {
+            continue;
+        }
+        int64_t from = find(name);
+        if (from < 0 || !std::binary_search(checked.begin(), checked.end(), static_cast<uint32_t>(from))) {
+            continue;
+        }
+        const SemanticAnalyzer::ImportedClasses& available = this->exports[from];
+        for (const auto& imported_name : import.names) {
+            if (imported_name.first == "*") {
+                for (const auto& entry : available) {
+                    imported[entry.first] = entry.second;
+                }
+                continue;
+            }
+            auto it = available.find(imported_name.first);
+            if (it != available.end()) {
+                imported[imported_name.second] = it->second;
+            }
+        }
+    }
+
+    module.diagnostics = analyzer.analyze(module.outline, &imported);
+    std::vector<SemanticAnalyzer::MethodTable>& classes = this->tables[id];
+    classes = analyzer.takeTables();
+    // Classes of the module hide imports of the same name, and the first
+    // definition of a name wins, as in the analyzer
+    SemanticAnalyzer::ImportedClasses& exported = this->exports[id];
+    exported = std::move(imported);
+    for (size_t i = module.outline.classes.size(); i-- > 0;) {
+        exported[module.outline.classes[i].name] = &classes[i];
+    }
+}
@@ -1,5 +1,8 @@
 // RecursiveDescendant.cpp
 #include "RecursiveDescendant.h"
+#include "Stats.h"
+#include "Str.h"
+#include "Word.h"
 #include <stdexcept>
 #include <iostream>
 
@@ -7,12 +10,31 @@ RecursiveDescendant::RecursiveDescendant(TokenStream* stream) : Parser(stream) {
 }
 
 void RecursiveDescendant::parse() {
-    try {
-        program();
-    } catch (const std::runtime_error& e) {
-        std::cerr << e.what() << std::endl;
-        throw e;
-    }
+    STATS_TIMER(Phase::Parse);
+    // Errors propagate as std::runtime_error; reporting them is up to the
+    // caller, batch drivers parse millions of snippets and stay quiet
+    result = Outline();
+    current_class = -1;
+    brackets = 0;
+    layout_debt = 0;
+    decorators = 0;
+    current_method = nullptr;
+    program();
+}
+
+std::string_view RecursiveDescendant::lexeme() const {
+    Word* word = dynamic_cast<Word*>(look);
+    return word ? word->lexeme : std::string_view();
+}
+
+void RecursiveDescendant::beginMethod() {
+    std::vector<MethodInfo>& methods = current_class >= 0
+        ? result.classes[current_class].methods
+        : result.functions;
+    methods.emplace_back();
+    current_method = &methods.back();
+    current_method->decorators = decorators;
+    decorators = 0;
 }
 
 void RecursiveDescendant::program() {
@@ -60,10 +82,14 @@ void RecursiveDescendant::moreClassDefs() {
 
 void RecursiveDescendant::classDef() {
     match(static_cast<int>(Tag::CLASS));
+    result.classes.emplace_back();
+    result.classes.back().name = lexeme();
+    current_class = static_cast<int>(result.classes.size()) - 1;
     match(static_cast<int>(Tag::VARIABLE));
     inheritance();
     match(static_cast<int>(Tag::COLON));
     classSuite();
+    current_class = -1;
 }
 
 void RecursiveDescendant::inheritance() {
@@ -75,6 +101,7 @@ void RecursiveDescendant::inheritance() {
 }
 
 void RecursiveDescendant::parentList() {
+    result.classes[current_class].parents.emplace_back(lexeme());
     match(static_cast<int>(Tag::VARIABLE));
     moreParents();
 }
@@ -82,6 +109,7 @@ void RecursiveDescendant::parentList() {
 void RecursiveDescendant::moreParents() {
     if (isType(static_cast<int>(Tag::COMMA))) {
         match(static_cast<int>(Tag::COMMA));
+        result.classes[current_class].parents.emplace_back(lexeme());
         match(static_cast<int>(Tag::VARIABLE));
         moreParents();
     }
@@ -105,18 +133,22 @@ void RecursiveDescendant::moreMethodDefs() {
 
 void RecursiveDescendant::methodDef() {
     if (isType(static_cast<int>(Tag::CLASSMETHOD))) {
+        decorators |= DECORATOR_CLASSMETHOD;
         match(static_cast<int>(Tag::CLASSMETHOD));
         match(static_cast<int>(Tag::NEWLINE));
         methodDefCls();
     } else if (isType(static_cast<int>(Tag::PROPERTY))) {
+        decorators |= DECORATOR_PROPERTY;
         match(static_cast<int>(Tag::PROPERTY));
         match(static_cast<int>(Tag::NEWLINE));
         methodDefSelf();
     } else if (isType(static_cast<int>(Tag::ABSTRACTMETHOD))) {
+        decorators |= DECORATOR_ABSTRACTMETHOD;
         match(static_cast<int>(Tag::ABSTRACTMETHOD));
         match(static_cast<int>(Tag::NEWLINE));
         methodDefSelf();
     } else if (isType(static_cast<int>(Tag::STATICMETHOD))) {
+        decorators |= DECORATOR_STATICMETHOD;
         match(static_cast<int>(Tag::STATICMETHOD));
         match(static_cast<int>(Tag::NEWLINE));
         methodDefRaw();
@@ -127,6 +159,7 @@ void RecursiveDescendant::methodDef() {
 
 void RecursiveDescendant::methodDefRaw() {
     match(static_cast<int>(Tag::DEF));
+    beginMethod();
     methodName();
     match(static_cast<int>(Tag::OPEN_PARENTHESIS));
     paramList();
@@ -136,8 +169,10 @@ void RecursiveDescendant::methodDefRaw() {
 
 void RecursiveDescendant::methodDefSelf() {
     match(static_cast<int>(Tag::DEF));
+    beginMethod();
     methodName();
     match(static_cast<int>(Tag::OPEN_PARENTHESIS));
+    current_method->params.push_back({std::string(lexeme()), nullptr, 0, false});
     match(static_cast<int>(Tag::SELF));
     moreParams();
     match(static_cast<int>(Tag::CLOSE_PARENTHESIS));
@@ -146,8 +181,10 @@ void RecursiveDescendant::methodDefSelf() {
 
 void RecursiveDescendant::methodDefCls() {
     match(static_cast<int>(Tag::DEF));
+    beginMethod();
     methodName();
     match(static_cast<int>(Tag::OPEN_PARENTHESIS));
+    current_method->params.push_back({std::string(lexeme()), nullptr, 0, false});
     match(static_cast<int>(Tag::CLS));
     moreParams();
     match(static_cast<int>(Tag::CLOSE_PARENTHESIS));
@@ -161,6 +198,7 @@ void RecursiveDescendant::methodDefTail() {
 }
 
 void RecursiveDescendant::methodName() {
+    current_method->name = lexeme();
     if (isType(static_cast<int>(Tag::INIT))) {
         match(static_cast<int>(Tag::INIT));
     } else {
@@ -184,20 +222,27 @@ void RecursiveDescendant::moreParams() {
 }
 
 void RecursiveDescendant::parameter() {
+    current_method->params.emplace_back();
     paramName();
     typeHint();
     defaultValue();
 }
 
 void RecursiveDescendant::paramName() {
+    ParamInfo& param = current_method->params.back();
     if (isType(static_cast<int>(Tag::VARIABLE))) {
+        param.name = lexeme();
         match(static_cast<int>(Tag::VARIABLE));
     } else {
         match(static_cast<int>(Tag::MULT));
+        param.stars = 1;
         if (isType(static_cast<int>(Tag::VARIABLE))) {
+            param.name = lexeme();
             match(static_cast<int>(Tag::VARIABLE));
         } else {
             match(static_cast<int>(Tag::MULT));
+            param.stars = 2;
+            param.name = lexeme();
             match(static_cast<int>(Tag::VARIABLE));
         }
     }
@@ -206,13 +251,14 @@ void RecursiveDescendant::paramName() {
 void RecursiveDescendant::typeHint() {
     if (isType(static_cast<int>(Tag::COLON))) {
         match(static_cast<int>(Tag::COLON));
-        match(static_cast<int>(Tag::TYPE));
+        current_method->params.back().type = typeExpression();
     }
 }
 
 void RecursiveDescendant::defaultValue() {
     if (isType(static_cast<int>(Tag::ASSIGN))) {
         match(static_cast<int>(Tag::ASSIGN));
+        current_method->params.back().has_default = true;
         skipDefault();
     }
 }
@@ -220,7 +266,75 @@ void RecursiveDescendant::defaultValue() {
 void RecursiveDescendant::returnType() {
     if (isType(static_cast<int>(Tag::ARROW))) {
         match(static_cast<int>(Tag::ARROW));
+        current_method->return_type = typeExpression();
+    }
+}
+
+// A dotted name with [arguments], None, a forward reference in a string,
+// ... or a [list] of types (the parameters of Callable[[int], str]), made
+// into the node of that type in the outline's table
+const TypeNode* RecursiveDescendant::typeExpression() {
+    if (!result.types) {
+        result.types = std::make_shared<TypeTable>();
+    }
+    TypeTable& types = *result.types;
+    if (isType(static_cast<int>(Tag::NONE))) {
+        match(static_cast<int>(Tag::NONE));
+        return types.name("None");
+    }
+    if (isType(static_cast<int>(Tag::STRING))) {
+        Str* str = dynamic_cast<Str*>(look);
+        const TypeNode* type = types.name(str ? str->value() : std::string());
+        match(static_cast<int>(Tag::STRING));
+        return type;
+    }
+    if (isType(static_cast<int>(Tag::DOT))) {
+        // The lexer has no ellipsis token: ... is three DOTs
+        match(static_cast<int>(Tag::DOT));
+        match(static_cast<int>(Tag::DOT));
+        match(static_cast<int>(Tag::DOT));
+        return types.ellipsis();
+    }
+    std::vector<const TypeNode*> args;
+    if (isType(static_cast<int>(Tag::OPEN_BRACKET))) {
+        match(static_cast<int>(Tag::OPEN_BRACKET));
+        if (!isType(static_cast<int>(Tag::CLOSE_BRACKET))) {
+            typeList(args);
+        }
+        match(static_cast<int>(Tag::CLOSE_BRACKET));
+        return types.list(std::move(args));
+    }
+
+    std::string name(lexeme());
+    typeNamePart();
+    while (isType(static_cast<int>(Tag::DOT))) {
+        match(static_cast<int>(Tag::DOT));
+        name += '.';
+        name += lexeme();
+        typeNamePart();
+    }
+    if (!isType(static_cast<int>(Tag::OPEN_BRACKET))) {
+        return types.name(name);
+    }
+    match(static_cast<int>(Tag::OPEN_BRACKET));
+    typeList(args);
+    match(static_cast<int>(Tag::CLOSE_BRACKET));
+    return types.generic(name, std::move(args));
+}
+
+void RecursiveDescendant::typeNamePart() {
+    if (isType(static_cast<int>(Tag::TYPE))) {
         match(static_cast<int>(Tag::TYPE));
+    } else {
+        match(static_cast<int>(Tag::VARIABLE));
+    }
+}
+
+void RecursiveDescendant::typeList(std::vector<const TypeNode*>& types) {
+    types.push_back(typeExpression());
+    while (isType(static_cast<int>(Tag::COMMA))) {
+        match(static_cast<int>(Tag::COMMA));
+        types.push_back(typeExpression());
     }
 }
 
@@ -245,7 +359,11 @@ void RecursiveDescendant::classBody() {
 }
 
 void RecursiveDescendant::methodBody() {
-    if (look && !isType(static_cast<int>(Tag::DEDENT))) {
+    if (parse_bodies) {
+        brackets = 0;
+        layout_debt = 0;
+        current_method->body = block();
+    } else if (look && !isType(static_cast<int>(Tag::DEDENT))) {
         skipStatement();
     }
 }
@@ -273,20 +391,1453 @@ void RecursiveDescendant::skipDefault() {
     }
 }
 
+// Skipped code is only looked into for import statements at the start of
+// a line, which are recorded without consuming any token that begins a
+// definition, so what is accepted does not change
 void RecursiveDescendant::preSkipStatements() {
+    bool line_start = true;
     while (look && !isType(static_cast<int>(Tag::CLASS)) && 
             !isType(static_cast<int>(Tag::DEF)) &&
             !isType(static_cast<int>(Tag::CLASSMETHOD)) &&
             !isType(static_cast<int>(Tag::PROPERTY)) &&
             !isType(static_cast<int>(Tag::STATICMETHOD)) &&
             !isType(static_cast<int>(Tag::ABSTRACTMETHOD))) {
+        if (line_start && (isType(static_cast<int>(Tag::IMPORT)) || isType(static_cast<int>(Tag::FROM)))) {
+            recordImport();
+            line_start = false;
+            continue;
+        }
+        line_start = isType(static_cast<int>(Tag::NEWLINE)) || isType(static_cast<int>(Tag::INDENT)) ||
+                     isType(static_cast<int>(Tag::DEDENT));
         move();
     }
 
 }
 
 void RecursiveDescendant::postSkipStatements() {
+    bool line_start = true;
+    while (look) {
+        if (line_start && (isType(static_cast<int>(Tag::IMPORT)) || isType(static_cast<int>(Tag::FROM)))) {
+            recordImport();
+            line_start = false;
+            continue;
+        }
+        line_start = isType(static_cast<int>(Tag::NEWLINE)) || isType(static_cast<int>(Tag::INDENT)) ||
+                     isType(static_cast<int>(Tag::DEDENT));
+        move();
+    }
+}
+
+// import a.b [as c], ... or from [.]a.b import (* | x [as y], ...). Stops
+// at the end of the line or at the first token that does not fit, and
+// records nothing for a statement that is not an import (raise ... from).
+void RecursiveDescendant::recordImport() {
+    bool from = isType(static_cast<int>(Tag::FROM));
+    move();
+    if (!from) {
+        for (;;) {
+            ImportInfo import;
+            if (!importName(import.module)) {
+                return;
+            }
+            if (lexeme() == "as") {
+                move();
+                std::string alias;
+                importName(alias);
+            }
+            result.imports.push_back(std::move(import));
+            if (!isType(static_cast<int>(Tag::COMMA))) {
+                return;
+            }
+            move();
+        }
+    }
+
+    ImportInfo import;
+    while (isType(static_cast<int>(Tag::DOT))) {
+        import.level++;
+        move();
+    }
+    if (!isType(static_cast<int>(Tag::IMPORT)) && !importName(import.module)) {
+        return;
+    }
+    if (!isType(static_cast<int>(Tag::IMPORT)) || (import.module.empty() && import.level == 0)) {
+        return;
+    }
+    move();
+    if (isType(static_cast<int>(Tag::MULT))) {
+        move();
+        import.names.emplace_back("*", "*");
+        result.imports.push_back(std::move(import));
+        return;
+    }
+    // Names in parentheses may span lines
+    bool parenthesized = isType(static_cast<int>(Tag::OPEN_PARENTHESIS));
+    if (parenthesized) {
+        move();
+    }
+    for (;;) {
+        while (parenthesized && (isType(static_cast<int>(Tag::NEWLINE)) || isType(static_cast<int>(Tag::INDENT)) ||
+                                 isType(static_cast<int>(Tag::DEDENT)))) {
+            move();
+        }
+        std::string name;
+        if (!importName(name)) {
+            break;
+        }
+        std::string bound = name;
+        if (lexeme() == "as") {
+            move();
+            importName(bound);
+        }
+        import.names.emplace_back(std::move(name), std::move(bound));
+        if (!isType(static_cast<int>(Tag::COMMA))) {
+            break;
+        }
+        move();
+    }
+    if (parenthesized && isType(static_cast<int>(Tag::CLOSE_PARENTHESIS))) {
+        move();
+    }
+    if (!import.names.empty()) {
+        result.imports.push_back(std::move(import));
+    }
+}
+
+// Dotted name of an import statement; false if there is none. Only plain
+// words are taken, never a token that begins a definition.
+bool RecursiveDescendant::importName(std::string& name) {
+    name.clear();
+    for (;;) {
+        if (!isType(static_cast<int>(Tag::VARIABLE)) && !isType(static_cast<int>(Tag::TYPE)) &&
+            !isType(static_cast<int>(Tag::ANY)) && !isType(static_cast<int>(Tag::INIT))) {
+            return false;
+        }
+        name += lexeme();
+        move();
+        if (!isType(static_cast<int>(Tag::DOT))) {
+            return true;
+        }
+        name += '.';
+        move();
+    }
+}
+
+// Method bodies
+
+namespace {
+
+// Binding powers of the expression parser, loosest first. Postfix
+// operators (calls, subscripts, attributes) bind tighter than all of them
+// and are applied to atoms directly.
+enum Power {
+    TERNARY = 1,    // a if b else c
+    OR,
+    AND,
+    NOT,            // Prefix only
+    COMPARISON,     // == != < <= > >= in, not in, is, is not
+    SHIFT,          // << >>
+    SUM,            // + -
+    PRODUCT,        // * / // %
+    UNARY,          // Prefix + -
+    EXPONENT        // **, right associative
+};
+
+bool hasTag(const Token* token, Tag tag) {
+    return token && token->tag == static_cast<int>(tag);
+}
+
+bool hasLexeme(const Token* token, std::string_view text) {
+    const Word* word = dynamic_cast<const Word*>(token);
+    return word && word->lexeme == text;
+}
+
+// f"", r"", b"", u"" and their combinations, in any case. The lexer makes a
+// VARIABLE of the prefix and a STRING of the quoted part.
+bool isStringPrefix(std::string_view text) {
+    if (text.empty() || text.size() > 2) {
+        return false;
+    }
+    std::string lower;
+    for (char c : text) {
+        lower += static_cast<char>(c | 0x20);
+    }
+    return lower == "f" || lower == "r" || lower == "b" || lower == "u" ||
+           lower == "fr" || lower == "rf" || lower == "br" || lower == "rb";
+}
+
+// Keywords the lexer makes VARIABLEs of, which cannot be names
+bool isKeyword(std::string_view text) {
+    static const char* const keywords[] = {
+        "as", "assert", "async", "await", "del", "except", "finally", "global", "lambda",
+        "nonlocal", "raise", "try", "with", "yield"
+    };
+    for (const char* keyword : keywords) {
+        if (text == keyword) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+void RecursiveDescendant::advance() {
+    move();
+    skipLayout();
+}
+
+void RecursiveDescendant::skipLayout() {
     while (look) {
+        if (look->tag == static_cast<int>(Tag::NEWLINE) && brackets > 0) {
+            // Line continued inside brackets
+        } else if (look->tag == static_cast<int>(Tag::INDENT) && (brackets > 0 || layout_debt < 0)) {
+            layout_debt++;
+        } else if (look->tag == static_cast<int>(Tag::DEDENT) && (brackets > 0 || layout_debt > 0)) {
+            layout_debt--;
+        } else {
+            break;
+        }
         move();
     }
-}
\ No newline at end of file
+}
+
+void RecursiveDescendant::expect(Tag tag) {
+    if (!isTag(tag)) {
+        error(std::string("Expected ") + tagName(static_cast<int>(tag)));
+    }
+    advance();
+}
+
+bool RecursiveDescendant::isTag(Tag tag) const {
+    return hasTag(look, tag);
+}
+
+bool RecursiveDescendant::isWord(const char* text) const {
+    return isTag(Tag::VARIABLE) && lexeme() == text;
+}
+
+bool RecursiveDescendant::isName() const {
+    return (isTag(Tag::VARIABLE) && !isKeyword(lexeme())) || isTag(Tag::TYPE) || isTag(Tag::ANY) || isTag(Tag::SELF) ||
+           isTag(Tag::CLS) || isTag(Tag::SUPER) || isTag(Tag::INIT);
+}
+
+bool RecursiveDescendant::startsExpression() const {
+    return isName() || isWord("lambda") || isWord("await") || isTag(Tag::NUM) || isTag(Tag::STRING) || isTag(Tag::DOCSTRING) ||
+           isTag(Tag::TRUE) || isTag(Tag::FALSE) || isTag(Tag::NONE) ||
+           isTag(Tag::OPEN_PARENTHESIS) || isTag(Tag::OPEN_BRACKET) || isTag(Tag::OPEN_BRACE) ||
+           isTag(Tag::PLUS) || isTag(Tag::MINUS) || isTag(Tag::NOT) || isTag(Tag::MULT) ||
+           isTag(Tag::DOT);
+}
+
+bool RecursiveDescendant::startsComprehension() const {
+    return isTag(Tag::FOR) || (isWord("async") && hasTag(lookAhead(1), Tag::FOR));
+}
+
+Token* RecursiveDescendant::lookAhead(size_t distance) const {
+    size_t pos = here() + distance;
+    return pos < stream->size() ? stream->at(pos) : nullptr;
+}
+
+uint32_t RecursiveDescendant::here() const {
+    return static_cast<uint32_t>(look ? stream->position() - 1 : stream->size());
+}
+
+int32_t RecursiveDescendant::node(AstKind kind, uint32_t token, AstOp op) {
+    result.ast.push_back({kind, op, token, -1, -1});
+    return static_cast<int32_t>(result.ast.size()) - 1;
+}
+
+void RecursiveDescendant::append(int32_t parent, int32_t& last, int32_t child) {
+    if (last < 0) {
+        result.ast[parent].first_child = child;
+    } else {
+        result.ast[last].next_sibling = child;
+    }
+    last = child;
+}
+
+void RecursiveDescendant::openBracket() {
+    brackets++;
+    advance();
+}
+
+void RecursiveDescendant::closeBracket(Tag tag) {
+    if (!isTag(tag)) {
+        error(std::string("Expected ") + tagName(static_cast<int>(tag)));
+    }
+    brackets--;
+    advance();
+}
+
+// Statements up to the DEDENT that closes the block, which is left to the
+// caller. A DEDENT dropped inside brackets closes it too.
+int32_t RecursiveDescendant::block() {
+    int32_t body = node(AstKind::Body, here());
+    int32_t last = -1;
+    while (look && !isTag(Tag::DEDENT) && layout_debt >= 0) {
+        if (isTag(Tag::NEWLINE)) {
+            advance();  // Blank or comment line
+            continue;
+        }
+        append(body, last, statement());
+    }
+    if (last < 0) {
+        error("Expected a statement");
+    }
+    return body;
+}
+
+// Body of a compound statement, after its colon: an indented block or a
+// simple statement on the same line
+int32_t RecursiveDescendant::suite() {
+    if (!isTag(Tag::NEWLINE)) {
+        int32_t body = node(AstKind::Body, here());
+        int32_t last = -1;
+        append(body, last, simpleStatement());
+        endOfLine();
+        return body;
+    }
+    while (isTag(Tag::NEWLINE)) {
+        advance();
+    }
+    if (layout_debt > 0 && !isTag(Tag::INDENT)) {
+        // The header continued on a deeper line inside brackets, and the
+        // lexer took that line's indentation for the one of the block
+        layout_debt--;
+    } else {
+        expect(Tag::INDENT);
+    }
+    int32_t body = block();
+    if (layout_debt < 0) {
+        layout_debt++;
+    } else {
+        expect(Tag::DEDENT);
+    }
+    return body;
+}
+
+int32_t RecursiveDescendant::statement() {
+    switch (static_cast<Tag>(look->tag)) {
+        case Tag::IF:
+            return ifStatement();
+        case Tag::WHILE:
+            return whileStatement();
+        case Tag::FOR:
+            return forStatement();
+        case Tag::CLASS:
+        case Tag::DEF:
+        case Tag::DECORATOR:
+        case Tag::PROPERTY:
+        case Tag::STATICMETHOD:
+        case Tag::CLASSMETHOD:
+        case Tag::ABSTRACTMETHOD:
+            return definition();
+        case Tag::VARIABLE:
+            if (isWord("try")) {
+                return tryStatement();
+            }
+            if (isWord("with")) {
+                return withStatement();
+            }
+            if (isWord("async")) {
+                Token* next = lookAhead(1);
+                if (hasTag(next, Tag::DEF) || hasTag(next, Tag::FOR) || hasLexeme(next, "with")) {
+                    advance();
+                    return statement();
+                }
+            }
+            break;
+        default:
+            break;
+    }
+    int32_t statement = simpleStatement();
+    endOfLine();
+    return statement;
+}
+
+int32_t RecursiveDescendant::simpleStatement() {
+    uint32_t at = here();
+    int32_t statement;
+    int32_t last = -1;
+    switch (static_cast<Tag>(look->tag)) {
+        case Tag::PASS:
+            advance();
+            return node(AstKind::Pass, at);
+        case Tag::BREAK:
+            advance();
+            return node(AstKind::Break, at);
+        case Tag::CONTINUE:
+            advance();
+            return node(AstKind::Continue, at);
+        case Tag::RETURN:
+            advance();
+            statement = node(AstKind::Return, at);
+            if (startsExpression()) {
+                append(statement, last, expressions());
+            }
+            return statement;
+        case Tag::IMPORT:
+            return importStatement();
+        case Tag::FROM:
+            return fromImport();
+        default:
+            break;
+    }
+
+    // Soft keywords: the lexer makes VARIABLEs of them
+    if (isWord("raise")) {
+        advance();
+        statement = node(AstKind::Raise, at);
+        if (startsExpression()) {
+            append(statement, last, expression());
+            if (isTag(Tag::FROM)) {
+                advance();
+                append(statement, last, expression());
+            }
+        }
+        return statement;
+    }
+    if (isWord("assert")) {
+        advance();
+        statement = node(AstKind::Assert, at);
+        append(statement, last, expression());
+        if (isTag(Tag::COMMA)) {
+            advance();
+            append(statement, last, expression());
+        }
+        return statement;
+    }
+    if (isWord("del")) {
+        advance();
+        statement = node(AstKind::Delete, at);
+        for (;;) {
+            int32_t target = expression();
+            checkTarget(target, TargetUse::Delete);
+            append(statement, last, target);
+            if (!isTag(Tag::COMMA)) {
+                break;
+            }
+            advance();
+            if (!startsExpression()) {
+                break;
+            }
+        }
+        return statement;
+    }
+    if (isWord("global") || isWord("nonlocal")) {
+        statement = node(isWord("global") ? AstKind::Global : AstKind::Nonlocal, at);
+        do {
+            advance();
+            if (!isName()) {
+                error("Expected a name");
+            }
+            append(statement, last, node(AstKind::Name, here()));
+            advance();
+        } while (isTag(Tag::COMMA));
+        return statement;
+    }
+    return expressionStatement();
+}
+
+void RecursiveDescendant::endOfLine() {
+    if (isTag(Tag::NEWLINE)) {
+        advance();
+    } else if (look && !isTag(Tag::DEDENT)) {
+        error("Expected the end of the line");
+    }
+}
+
+// if and elif: an elif is a nested If in the place of the else body
+int32_t RecursiveDescendant::ifStatement() {
+    int32_t statement = node(AstKind::If, here());
+    int32_t last = -1;
+    advance();
+    append(statement, last, expression());
+    expect(Tag::COLON);
+    append(statement, last, suite());
+    if (isTag(Tag::ELIF)) {
+        append(statement, last, ifStatement());
+    } else if (isTag(Tag::ELSE)) {
+        advance();
+        expect(Tag::COLON);
+        append(statement, last, suite());
+    }
+    return statement;
+}
+
+int32_t RecursiveDescendant::whileStatement() {
+    int32_t statement = node(AstKind::While, here());
+    int32_t last = -1;
+    advance();
+    append(statement, last, expression());
+    expect(Tag::COLON);
+    append(statement, last, suite());
+    if (isTag(Tag::ELSE)) {
+        advance();
+        expect(Tag::COLON);
+        append(statement, last, suite());
+    }
+    return statement;
+}
+
+int32_t RecursiveDescendant::forStatement() {
+    int32_t statement = node(AstKind::For, here());
+    int32_t last = -1;
+    advance();
+    // Targets stop short of comparisons, which leaves the "in" alone
+    int32_t target = expressions(SHIFT);
+    checkTarget(target, TargetUse::Assign);
+    append(statement, last, target);
+    expect(Tag::IN);
+    append(statement, last, expressions());
+    expect(Tag::COLON);
+    append(statement, last, suite());
+    if (isTag(Tag::ELSE)) {
+        advance();
+        expect(Tag::COLON);
+        append(statement, last, suite());
+    }
+    return statement;
+}
+
+int32_t RecursiveDescendant::tryStatement() {
+    int32_t statement = node(AstKind::Try, here());
+    int32_t last = -1;
+    advance();
+    expect(Tag::COLON);
+    append(statement, last, suite());
+
+    bool handled = false;
+    while (isWord("except")) {
+        int32_t handler = node(AstKind::Handler, here());
+        int32_t handler_last = -1;
+        advance();
+        if (!isTag(Tag::COLON)) {
+            append(handler, handler_last, expression());
+            if (isWord("as")) {
+                advance();
+                if (!isName()) {
+                    error("Expected a name");
+                }
+                append(handler, handler_last, node(AstKind::Name, here()));
+                advance();
+            }
+        }
+        expect(Tag::COLON);
+        append(handler, handler_last, suite());
+        append(statement, last, handler);
+        handled = true;
+    }
+    bool has_else = handled && isTag(Tag::ELSE);
+    if (has_else) {
+        advance();
+        expect(Tag::COLON);
+        append(statement, last, suite());
+    }
+    if (isWord("finally")) {
+        if (!has_else) {
+            append(statement, last, node(AstKind::Empty, here()));
+        }
+        advance();
+        expect(Tag::COLON);
+        append(statement, last, suite());
+        handled = true;
+    }
+    if (!handled) {
+        error("Expected except or finally");
+    }
+    return statement;
+}
+
+int32_t RecursiveDescendant::withStatement() {
+    int32_t statement = node(AstKind::With, here());
+    int32_t last = -1;
+    do {
+        advance();  // with, or the comma before the next item
+        int32_t item = node(AstKind::WithItem, here());
+        int32_t item_last = -1;
+        append(item, item_last, expression());
+        if (isWord("as")) {
+            advance();
+            int32_t target = starExpression(SHIFT);
+            checkTarget(target, TargetUse::Assign);
+            append(item, item_last, target);
+        }
+        append(statement, last, item);
+    } while (isTag(Tag::COMMA));
+    expect(Tag::COLON);
+    append(statement, last, suite());
+    return statement;
+}
+
+int32_t RecursiveDescendant::importStatement() {
+    int32_t statement = node(AstKind::Import, here());
+    int32_t last = -1;
+    do {
+        advance();  // import, or the comma before the next module
+        append(statement, last, alias());
+    } while (isTag(Tag::COMMA));
+    return statement;
+}
+
+int32_t RecursiveDescendant::fromImport() {
+    int32_t statement = node(AstKind::ImportFrom, here());
+    int32_t last = -1;
+    advance();
+    bool relative = false;
+    while (isTag(Tag::DOT)) {
+        advance();
+        relative = true;
+    }
+    if (!isTag(Tag::IMPORT) || !relative) {
+        append(statement, last, dottedName());
+    }
+    expect(Tag::IMPORT);
+    if (isTag(Tag::MULT)) {
+        advance();
+        return statement;
+    }
+    bool parenthesized = isTag(Tag::OPEN_PARENTHESIS);
+    if (parenthesized) {
+        openBracket();
+    }
+    for (;;) {
+        append(statement, last, alias());
+        if (!isTag(Tag::COMMA)) {
+            break;
+        }
+        advance();
+        if (parenthesized && isTag(Tag::CLOSE_PARENTHESIS)) {
+            break;
+        }
+    }
+    if (parenthesized) {
+        closeBracket(Tag::CLOSE_PARENTHESIS);
+    }
+    return statement;
+}
+
+int32_t RecursiveDescendant::alias() {
+    int32_t alias = node(AstKind::Alias, here());
+    int32_t last = -1;
+    append(alias, last, dottedName());
+    if (isWord("as")) {
+        advance();
+        if (!isName()) {
+            error("Expected a name");
+        }
+        append(alias, last, node(AstKind::Name, here()));
+        advance();
+    }
+    return alias;
+}
+
+// a.b.c as nested Attributes of a Name
+int32_t RecursiveDescendant::dottedName() {
+    if (!isName()) {
+        error("Expected a name");
+    }
+    int32_t name = node(AstKind::Name, here());
+    advance();
+    while (isTag(Tag::DOT)) {
+        advance();
+        if (!isName()) {
+            error("Expected a name");
+        }
+        int32_t attribute = node(AstKind::Attribute, here());
+        int32_t last = -1;
+        append(attribute, last, name);
+        name = attribute;
+        advance();
+    }
+    return name;
+}
+
+// Nested def or class, with its decorators
+int32_t RecursiveDescendant::definition() {
+    int32_t first_decorator = -1;
+    int32_t last_decorator = -1;
+    while (isTag(Tag::DECORATOR) || isTag(Tag::PROPERTY) || isTag(Tag::STATICMETHOD) ||
+           isTag(Tag::CLASSMETHOD) || isTag(Tag::ABSTRACTMETHOD)) {
+        int32_t decorator = node(AstKind::Name, here());
+        advance();
+        decorator = postfix(decorator);
+        if (last_decorator < 0) {
+            first_decorator = decorator;
+        } else {
+            result.ast[last_decorator].next_sibling = decorator;
+        }
+        last_decorator = decorator;
+        expect(Tag::NEWLINE);
+        while (isTag(Tag::NEWLINE)) {
+            advance();
+        }
+    }
+    if (isWord("async")) {
+        advance();
+    }
+
+    bool is_class = isTag(Tag::CLASS);
+    if (!is_class && !isTag(Tag::DEF)) {
+        error("Expected def or class");
+    }
+    advance();
+    if (!isName()) {
+        error("Expected a name");
+    }
+    int32_t definition = node(is_class ? AstKind::ClassDef : AstKind::FunctionDef, here());
+    int32_t last = last_decorator;
+    result.ast[definition].first_child = first_decorator;
+    advance();
+
+    if (is_class) {
+        if (isTag(Tag::OPEN_PARENTHESIS)) {
+            arguments(definition, last);
+        }
+    } else {
+        if (!isTag(Tag::OPEN_PARENTHESIS)) {
+            error("Expected OPEN_PARENTHESIS");
+        }
+        openBracket();
+        parameters(definition, last, Tag::CLOSE_PARENTHESIS, true);
+        closeBracket(Tag::CLOSE_PARENTHESIS);
+        if (isTag(Tag::ARROW)) {
+            advance();
+            append(definition, last, expression());
+        } else {
+            append(definition, last, node(AstKind::Empty, here()));
+        }
+    }
+    expect(Tag::COLON);
+    append(definition, last, suite());
+    return definition;
+}
+
+// Parameters of a def (annotated) or a lambda, up to the close tag, which is
+// left to the caller. The / of positional-only parameters is skipped.
+void RecursiveDescendant::parameters(int32_t parent, int32_t& last, Tag close, bool annotated) {
+    while (!isTag(close)) {
+        uint32_t at = here();
+        if (isTag(Tag::DIV)) {
+            advance();
+        } else {
+            AstOp op = AstOp::None;
+            if (isTag(Tag::MULT)) {
+                advance();
+                op = AstOp::Star;
+                if (isTag(Tag::MULT)) {
+                    advance();
+                    op = AstOp::DoubleStar;
+                }
+            }
+            int32_t parameter;
+            if (isName()) {
+                parameter = node(AstKind::Parameter, here(), op);
+                advance();
+            } else if (op == AstOp::Star) {
+                parameter = node(AstKind::Parameter, at, op);  // Bare *
+            } else {
+                error("Expected a parameter");
+            }
+            int32_t parameter_last = -1;
+            if (annotated && isTag(Tag::COLON)) {
+                advance();
+                append(parameter, parameter_last, expression());
+            } else {
+                append(parameter, parameter_last, node(AstKind::Empty, here()));
+            }
+            if (isTag(Tag::ASSIGN)) {
+                advance();
+                append(parameter, parameter_last, expression());
+            }
+            append(parent, last, parameter);
+        }
+        if (!isTag(Tag::COMMA)) {
+            break;
+        }
+        advance();
+    }
+}
+
+// Expression statements and assignments
+int32_t RecursiveDescendant::expressionStatement() {
+    uint32_t at = here();
+    int32_t target = isWord("yield") ? yieldExpression() : expressions();
+    int32_t statement;
+    int32_t last = -1;
+
+    AstOp op;
+    int length = augmentedAssign(op);
+    if (length > 0) {
+        statement = node(AstKind::AugAssign, here(), op);
+        for (int i = 0; i < length; i++) {
+            advance();
+        }
+        checkTarget(target, TargetUse::Augmented);
+        append(statement, last, target);
+        append(statement, last, isWord("yield") ? yieldExpression() : expressions());
+    } else if (isTag(Tag::ASSIGN)) {
+        // Every expression but the last one of a = b = value is a target
+        statement = node(AstKind::Assign, at);
+        int32_t value = target;
+        while (isTag(Tag::ASSIGN)) {
+            checkTarget(value, TargetUse::Assign);
+            append(statement, last, value);
+            advance();
+            value = isWord("yield") ? yieldExpression() : expressions();
+        }
+        append(statement, last, value);
+    } else if (isTag(Tag::COLON)) {
+        statement = node(AstKind::AnnAssign, at);
+        checkTarget(target, TargetUse::Annotated);
+        advance();
+        append(statement, last, target);
+        append(statement, last, expression());
+        if (isTag(Tag::ASSIGN)) {
+            advance();
+            append(statement, last, isWord("yield") ? yieldExpression() : expressions());
+        }
+    } else {
+        statement = node(AstKind::Expression, at);
+        append(statement, last, target);
+    }
+    return statement;
+}
+
+// Tokens of an augmented assignment operator at look (+= is PLUS ASSIGN,
+// **= is MULT MULT ASSIGN, <<= is LOGIC_OP "<" LOGIC_OP "<="), or 0
+int RecursiveDescendant::augmentedAssign(AstOp& op) const {
+    if (!look) {
+        return 0;
+    }
+    Token* next = lookAhead(1);
+    switch (static_cast<Tag>(look->tag)) {
+        case Tag::PLUS:
+            op = AstOp::Add;
+            return hasTag(next, Tag::ASSIGN) ? 2 : 0;
+        case Tag::MINUS:
+            op = AstOp::Sub;
+            return hasTag(next, Tag::ASSIGN) ? 2 : 0;
+        case Tag::MOD:
+            op = AstOp::Mod;
+            return hasTag(next, Tag::ASSIGN) ? 2 : 0;
+        case Tag::MULT:
+        case Tag::DIV:
+            if (hasTag(next, Tag::ASSIGN)) {
+                op = isTag(Tag::MULT) ? AstOp::Mult : AstOp::Div;
+                return 2;
+            }
+            if (next && next->tag == look->tag && hasTag(lookAhead(2), Tag::ASSIGN)) {
+                op = isTag(Tag::MULT) ? AstOp::Pow : AstOp::FloorDiv;
+                return 3;
+            }
+            return 0;
+        case Tag::LOGIC_OP:
+            if (hasLexeme(look, "<") && hasLexeme(next, "<=")) {
+                op = AstOp::LShift;
+                return 2;
+            }
+            if (hasLexeme(look, ">") && hasLexeme(next, ">=")) {
+                op = AstOp::RShift;
+                return 2;
+            }
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+// Python assigns to names, attributes, subscripts and tuples or lists of
+// them, optionally starred, and deletes the same but starred ones. An
+// augmented assignment or an annotation takes a single name, attribute or
+// subscript. Parentheses leave no node, so (a) = 1 is a Name target.
+void RecursiveDescendant::checkTarget(int32_t target, TargetUse use) {
+    const AstNode& node = result.ast[target];
+    switch (node.kind) {
+        case AstKind::Name:
+        case AstKind::Attribute:
+        case AstKind::Subscript:
+            return;
+        case AstKind::Tuple:
+        case AstKind::List:
+            if (use == TargetUse::Assign || use == TargetUse::Delete) {
+                for (int32_t child = node.first_child; child >= 0; child = result.ast[child].next_sibling) {
+                    checkTarget(child, use);
+                }
+                return;
+            }
+            break;
+        case AstKind::Starred:
+            if (use == TargetUse::Assign && result.ast[node.first_child].kind != AstKind::Starred) {
+                checkTarget(node.first_child, use);
+                return;
+            }
+            break;
+        default:
+            break;
+    }
+    const char* message = use == TargetUse::Assign    ? "Cannot assign to "
+                        : use == TargetUse::Delete    ? "Cannot delete "
+                        : use == TargetUse::Augmented ? "Invalid target of an augmented assignment: "
+                        : "Invalid target of an annotation: ";
+    error(message + std::string(astKindName(node.kind)));
+}
+
+// Comma separated expressions: a Tuple if there is a comma, the single
+// expression otherwise
+int32_t RecursiveDescendant::expressions(int min_power) {
+    uint32_t at = here();
+    int32_t first = starExpression(min_power);
+    if (!isTag(Tag::COMMA)) {
+        return first;
+    }
+    int32_t tuple = node(AstKind::Tuple, at);
+    int32_t last = -1;
+    append(tuple, last, first);
+    while (isTag(Tag::COMMA)) {
+        advance();
+        if (!startsExpression()) {
+            break;
+        }
+        append(tuple, last, starExpression(min_power));
+    }
+    return tuple;
+}
+
+int32_t RecursiveDescendant::starExpression(int min_power) {
+    if (!isTag(Tag::MULT)) {
+        return expression(min_power);
+    }
+    int32_t starred = node(AstKind::Starred, here(), AstOp::Star);
+    int32_t last = -1;
+    advance();
+    append(starred, last, expression(SHIFT));
+    return starred;
+}
+
+// Precedence climbing: parses a prefix, then folds in every infix operator
+// that binds at least as tight as min_power
+int32_t RecursiveDescendant::expression(int min_power) {
+    int32_t left = prefix();
+    AstOp op;
+    int power;
+    int length;
+    while (infix(op, power, length) && power >= min_power) {
+        uint32_t at = here();
+        int32_t parent;
+        int32_t last = -1;
+        if (isTag(Tag::IF)) {
+            advance();
+            parent = node(AstKind::IfExp, at);
+            append(parent, last, left);
+            append(parent, last, expression(OR));
+            expect(Tag::ELSE);
+            append(parent, last, expression(TERNARY));
+        } else {
+            for (int i = 0; i < length; i++) {
+                advance();
+            }
+            AstKind kind = power == OR || power == AND ? AstKind::BoolOp
+                         : power == COMPARISON ? AstKind::Compare
+                         : AstKind::Binary;
+            parent = node(kind, at, op);
+            append(parent, last, left);
+            append(parent, last, expression(op == AstOp::Pow ? EXPONENT : power + 1));
+        }
+        left = parent;
+    }
+    return left;
+}
+
+int32_t RecursiveDescendant::prefix() {
+    if (!look) {
+        error("Expected an expression");
+    }
+    uint32_t at = here();
+    int32_t parent;
+    int32_t last = -1;
+    switch (static_cast<Tag>(look->tag)) {
+        case Tag::PLUS:
+        case Tag::MINUS:
+            parent = node(AstKind::Unary, at, isTag(Tag::PLUS) ? AstOp::UAdd : AstOp::USub);
+            advance();
+            append(parent, last, expression(UNARY));
+            return parent;
+        case Tag::NOT:
+            parent = node(AstKind::Unary, at, AstOp::Not);
+            advance();
+            append(parent, last, expression(NOT));
+            return parent;
+        case Tag::NUM:
+            advance();
+            return postfix(node(AstKind::Number, at));
+        case Tag::STRING:
+        case Tag::DOCSTRING:
+            return postfix(strings());
+        case Tag::TRUE:
+        case Tag::FALSE:
+        case Tag::NONE:
+            advance();
+            return postfix(node(AstKind::Constant, at));
+        case Tag::DOT:
+            // The lexer has no ellipsis token: ... is three DOTs
+            advance();
+            expect(Tag::DOT);
+            expect(Tag::DOT);
+            return postfix(node(AstKind::Ellipsis, at));
+        case Tag::OPEN_PARENTHESIS:
+            return postfix(parenthesized());
+        case Tag::OPEN_BRACKET:
+            return postfix(listDisplay());
+        case Tag::OPEN_BRACE:
+            return postfix(braceDisplay());
+        case Tag::VARIABLE:
+            if (isWord("lambda")) {
+                return lambda();
+            }
+            if (isWord("await")) {
+                parent = node(AstKind::Await, at);
+                advance();
+                append(parent, last, prefix());
+                return parent;
+            }
+            if (isWord("yield")) {
+                error("yield outside of parentheses or an assignment");
+            }
+            if (isKeyword(lexeme())) {
+                error("Unexpected keyword");
+            }
+            if (isStringPrefix(lexeme()) &&
+                (hasTag(lookAhead(1), Tag::STRING) || hasTag(lookAhead(1), Tag::DOCSTRING))) {
+                return postfix(strings());
+            }
+            advance();
+            return postfix(node(AstKind::Name, at));
+        case Tag::TYPE:
+        case Tag::ANY:
+        case Tag::SELF:
+        case Tag::CLS:
+        case Tag::SUPER:
+        case Tag::INIT:
+            advance();
+            return postfix(node(AstKind::Name, at));
+        default:
+            error("Expected an expression");
+            return -1;
+    }
+}
+
+// Calls, subscripts and attribute accesses after a primary
+int32_t RecursiveDescendant::postfix(int32_t left) {
+    for (;;) {
+        if (isTag(Tag::OPEN_PARENTHESIS)) {
+            left = call(left);
+        } else if (isTag(Tag::OPEN_BRACKET)) {
+            left = subscript(left);
+        } else if (isTag(Tag::DOT)) {
+            advance();
+            if (!isName()) {
+                error("Expected a name");
+            }
+            int32_t attribute = node(AstKind::Attribute, here());
+            int32_t last = -1;
+            append(attribute, last, left);
+            advance();
+            left = attribute;
+        } else {
+            return left;
+        }
+    }
+}
+
+// Infix operator at look: its op, binding power and number of tokens. An
+// operator followed by = is an augmented assignment and ends the expression.
+bool RecursiveDescendant::infix(AstOp& op, int& power, int& length) const {
+    if (!look) {
+        return false;
+    }
+    Token* next = lookAhead(1);
+    length = 1;
+    switch (static_cast<Tag>(look->tag)) {
+        case Tag::IF:
+            op = AstOp::None;
+            power = TERNARY;
+            return true;
+        case Tag::OR:
+            op = AstOp::Or;
+            power = OR;
+            return true;
+        case Tag::AND:
+            op = AstOp::And;
+            power = AND;
+            return true;
+        case Tag::NOT:
+            op = AstOp::NotIn;
+            power = COMPARISON;
+            length = 2;
+            return hasTag(next, Tag::IN);
+        case Tag::IN:
+            op = AstOp::In;
+            power = COMPARISON;
+            return true;
+        case Tag::IS:
+            power = COMPARISON;
+            if (hasTag(next, Tag::NOT)) {
+                op = AstOp::IsNot;
+                length = 2;
+            } else {
+                op = AstOp::Is;
+            }
+            return true;
+        case Tag::LOGIC_OP: {
+            std::string_view text = lexeme();
+            if ((text == "<" || text == ">") && hasTag(next, Tag::LOGIC_OP)) {
+                // << and >> are two comparison tokens; <<= and >>= are assignments
+                if (!hasLexeme(next, text)) {
+                    return false;
+                }
+                op = text == "<" ? AstOp::LShift : AstOp::RShift;
+                power = SHIFT;
+                length = 2;
+                return true;
+            }
+            power = COMPARISON;
+            if (text == "==") {
+                op = AstOp::Eq;
+            } else if (text == "!=") {
+                op = AstOp::NotEq;
+            } else if (text == "<") {
+                op = AstOp::Lt;
+            } else if (text == "<=") {
+                op = AstOp::LtE;
+            } else if (text == ">") {
+                op = AstOp::Gt;
+            } else if (text == ">=") {
+                op = AstOp::GtE;
+            } else {
+                return false;
+            }
+            return true;
+        }
+        case Tag::PLUS:
+        case Tag::MINUS:
+            op = isTag(Tag::PLUS) ? AstOp::Add : AstOp::Sub;
+            power = SUM;
+            return !hasTag(next, Tag::ASSIGN);
+        case Tag::MOD:
+            op = AstOp::Mod;
+            power = PRODUCT;
+            return !hasTag(next, Tag::ASSIGN);
+        case Tag::MULT:
+        case Tag::DIV:
+            if (next && next->tag == look->tag) {
+                // ** and // are two tokens
+                op = isTag(Tag::MULT) ? AstOp::Pow : AstOp::FloorDiv;
+                power = isTag(Tag::MULT) ? EXPONENT : PRODUCT;
+                length = 2;
+                return !hasTag(lookAhead(2), Tag::ASSIGN);
+            }
+            op = isTag(Tag::MULT) ? AstOp::Mult : AstOp::Div;
+            power = PRODUCT;
+            return !hasTag(next, Tag::ASSIGN);
+        default:
+            return false;
+    }
+}
+
+// Adjacent string literals, each with an optional prefix
+int32_t RecursiveDescendant::strings() {
+    int32_t string = -1;
+    for (;;) {
+        if (isTag(Tag::STRING) || isTag(Tag::DOCSTRING)) {
+            if (string < 0) {
+                string = node(AstKind::String, here());
+            }
+            advance();
+        } else if (isTag(Tag::VARIABLE) && isStringPrefix(lexeme()) &&
+                   (hasTag(lookAhead(1), Tag::STRING) || hasTag(lookAhead(1), Tag::DOCSTRING))) {
+            advance();
+        } else {
+            return string;
+        }
+    }
+}
+
+// ( ): empty tuple, parenthesized expression, tuple or generator
+int32_t RecursiveDescendant::parenthesized() {
+    uint32_t at = here();
+    openBracket();
+    if (isTag(Tag::CLOSE_PARENTHESIS)) {
+        closeBracket(Tag::CLOSE_PARENTHESIS);
+        return node(AstKind::Tuple, at);
+    }
+    if (isWord("yield")) {
+        int32_t yield = yieldExpression();
+        closeBracket(Tag::CLOSE_PARENTHESIS);
+        return yield;
+    }
+    int32_t first = starExpression();
+    int32_t parent;
+    int32_t last = -1;
+    if (startsComprehension()) {
+        parent = node(AstKind::Generator, at);
+        append(parent, last, first);
+        comprehension(parent, last);
+    } else if (isTag(Tag::COMMA)) {
+        parent = node(AstKind::Tuple, at);
+        append(parent, last, first);
+        while (isTag(Tag::COMMA)) {
+            advance();
+            if (isTag(Tag::CLOSE_PARENTHESIS)) {
+                break;
+            }
+            append(parent, last, starExpression());
+        }
+    } else {
+        parent = first;
+    }
+    closeBracket(Tag::CLOSE_PARENTHESIS);
+    return parent;
+}
+
+// [ ]: list or list comprehension
+int32_t RecursiveDescendant::listDisplay() {
+    int32_t list = node(AstKind::List, here());
+    int32_t last = -1;
+    openBracket();
+    if (!isTag(Tag::CLOSE_BRACKET)) {
+        append(list, last, starExpression());
+        if (startsComprehension()) {
+            result.ast[list].kind = AstKind::ListComp;
+            comprehension(list, last);
+        } else {
+            while (isTag(Tag::COMMA)) {
+                advance();
+                if (isTag(Tag::CLOSE_BRACKET)) {
+                    break;
+                }
+                append(list, last, starExpression());
+            }
+        }
+    }
+    closeBracket(Tag::CLOSE_BRACKET);
+    return list;
+}
+
+// { }: dict, set or their comprehensions; {} is a dict
+int32_t RecursiveDescendant::braceDisplay() {
+    int32_t display = node(AstKind::Dict, here());
+    int32_t last = -1;
+    openBracket();
+    if (isTag(Tag::CLOSE_BRACE)) {
+        closeBracket(Tag::CLOSE_BRACE);
+        return display;
+    }
+
+    bool dict = true;
+    bool first = true;
+    do {
+        if (!first) {
+            advance();  // Comma
+            if (isTag(Tag::CLOSE_BRACE)) {
+                break;
+            }
+        }
+        if (dict && isTag(Tag::MULT) && hasTag(lookAhead(1), Tag::MULT)) {
+            // **mapping
+            append(display, last, node(AstKind::Empty, here()));
+            advance();
+            advance();
+            append(display, last, expression(SHIFT));
+        } else if (first) {
+            append(display, last, starExpression());
+            dict = isTag(Tag::COLON);
+            if (dict) {
+                advance();
+                append(display, last, expression());
+            }
+        } else if (dict) {
+            append(display, last, expression());
+            expect(Tag::COLON);
+            append(display, last, expression());
+        } else {
+            append(display, last, starExpression());
+        }
+        if (first && startsComprehension()) {
+            result.ast[display].kind = dict ? AstKind::DictComp : AstKind::SetComp;
+            comprehension(display, last);
+            break;
+        }
+        first = false;
+    } while (isTag(Tag::COMMA));
+    if (!dict) {
+        result.ast[display].kind = AstKind::Set;
+    }
+    closeBracket(Tag::CLOSE_BRACE);
+    return display;
+}
+
+// for ... in ... [if ...] clauses of a comprehension, appended to parent.
+// Its element cannot be unpacked: [*a for ...] or {**m for ...}, where the
+// Empty key stands for the **.
+int32_t RecursiveDescendant::comprehension(int32_t parent, int32_t last) {
+    AstKind element = result.ast[result.ast[parent].first_child].kind;
+    if (element == AstKind::Starred || element == AstKind::Empty) {
+        error("Unpacking cannot be used in a comprehension");
+    }
+    while (startsComprehension()) {
+        if (isWord("async")) {
+            advance();
+        }
+        int32_t clause = node(AstKind::ComprehensionFor, here());
+        int32_t clause_last = -1;
+        advance();
+        int32_t target = expressions(SHIFT);
+        checkTarget(target, TargetUse::Assign);
+        append(clause, clause_last, target);
+        expect(Tag::IN);
+        append(clause, clause_last, expression(OR));
+        while (isTag(Tag::IF)) {
+            advance();
+            append(clause, clause_last, expression(OR));
+        }
+        append(parent, last, clause);
+    }
+    return parent;
+}
+
+int32_t RecursiveDescendant::call(int32_t function) {
+    int32_t call = node(AstKind::Call, here());
+    int32_t last = -1;
+    append(call, last, function);
+    arguments(call, last);
+    return call;
+}
+
+// ( arguments ) of a call or of a class statement. Positional arguments
+// come before keywords and **mapping, *iterable before **mapping, and a
+// generator without its own parentheses is the only argument of a call.
+void RecursiveDescendant::arguments(int32_t parent, int32_t& last) {
+    openBracket();
+    bool keywords = false;         // A name=value seen
+    bool mappings = false;         // A **mapping seen
+    bool first = true;
+    while (!isTag(Tag::CLOSE_PARENTHESIS)) {
+        uint32_t at = here();
+        int32_t argument;
+        int32_t argument_last = -1;
+        if (isTag(Tag::MULT)) {
+            advance();
+            AstOp op = AstOp::Star;
+            if (isTag(Tag::MULT)) {
+                advance();
+                op = AstOp::DoubleStar;
+            } else if (mappings) {
+                error("Iterable argument unpacking follows keyword argument unpacking");
+            }
+            mappings = mappings || op == AstOp::DoubleStar;
+            argument = node(AstKind::Starred, at, op);
+            append(argument, argument_last, expression());
+        } else if (isName() && hasTag(lookAhead(1), Tag::ASSIGN)) {
+            keywords = true;
+            argument = node(AstKind::Keyword, at);
+            advance();
+            advance();
+            append(argument, argument_last, expression());
+        } else {
+            if (keywords || mappings) {
+                error(mappings ? "Positional argument follows keyword argument unpacking"
+                               : "Positional argument follows keyword argument");
+            }
+            argument = expression();
+            if (startsComprehension()) {
+                int32_t generator = node(AstKind::Generator, at);
+                append(generator, argument_last, argument);
+                argument = comprehension(generator, argument_last);
+                if (!first || !isTag(Tag::CLOSE_PARENTHESIS) || result.ast[parent].kind != AstKind::Call) {
+                    error("Generator expression must be parenthesized");
+                }
+            }
+        }
+        first = false;
+        append(parent, last, argument);
+        if (!isTag(Tag::COMMA)) {
+            break;
+        }
+        advance();
+    }
+    closeBracket(Tag::CLOSE_PARENTHESIS);
+}
+
+int32_t RecursiveDescendant::subscript(int32_t value) {
+    int32_t subscript = node(AstKind::Subscript, here());
+    int32_t last = -1;
+    append(subscript, last, value);
+    openBracket();
+    uint32_t at = here();
+    int32_t index = sliceItem();
+    if (isTag(Tag::COMMA)) {
+        int32_t tuple = node(AstKind::Tuple, at);
+        int32_t tuple_last = -1;
+        append(tuple, tuple_last, index);
+        while (isTag(Tag::COMMA)) {
+            advance();
+            if (isTag(Tag::CLOSE_BRACKET)) {
+                break;
+            }
+            append(tuple, tuple_last, sliceItem());
+        }
+        index = tuple;
+    }
+    append(subscript, last, index);
+    closeBracket(Tag::CLOSE_BRACKET);
+    return subscript;
+}
+
+// Index or lower:upper:step slice in a subscript
+int32_t RecursiveDescendant::sliceItem() {
+    uint32_t at = here();
+    int32_t lower = isTag(Tag::COLON) ? node(AstKind::Empty, at) : starExpression();
+    if (!isTag(Tag::COLON)) {
+        return lower;
+    }
+    int32_t slice = node(AstKind::Slice, at);
+    int32_t last = -1;
+    append(slice, last, lower);
+    advance();
+    bool missing = isTag(Tag::COLON) || isTag(Tag::COMMA) || isTag(Tag::CLOSE_BRACKET);
+    append(slice, last, missing ? node(AstKind::Empty, here()) : expression());
+    if (isTag(Tag::COLON)) {
+        advance();
+        missing = isTag(Tag::COMMA) || isTag(Tag::CLOSE_BRACKET);
+        append(slice, last, missing ? node(AstKind::Empty, here()) : expression());
+    } else {
+        append(slice, last, node(AstKind::Empty, here()));
+    }
+    return slice;
+}
+
+int32_t RecursiveDescendant::lambda() {
+    int32_t lambda = node(AstKind::Lambda, here());
+    int32_t last = -1;
+    advance();
+    parameters(lambda, last, Tag::COLON, false);
+    expect(Tag::COLON);
+    append(lambda, last, expression());
+    return lambda;
+}
+
+int32_t RecursiveDescendant::yieldExpression() {
+    int32_t yield = node(AstKind::Yield, here());
+    int32_t last = -1;
+    advance();
+    if (isTag(Tag::FROM)) {
+        result.ast[yield].op = AstOp::From;
+        advance();
+        append(yield, last, expression());
+    } else if (startsExpression()) {
+        append(yield, last, expressions());
+    }
+    return yield;
+}
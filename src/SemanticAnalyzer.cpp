@@ -0,0 +1,346 @@
+#include "SemanticAnalyzer.h"
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+
+namespace {
+
+struct Arity {
+    size_t required = 0;
+    size_t total = 0;
+    bool variadic = false;
+};
+
+// Parameters a caller passes, leaving out the implicit self/cls
+Arity arityOf(const MethodInfo& method) {
+    Arity arity;
+    bool implicit = !(method.decorators & DECORATOR_STATICMETHOD);
+    for (size_t i = implicit ? 1 : 0; i < method.params.size(); i++) {
+        const ParamInfo& param = method.params[i];
+        if (param.stars != 0) {
+            arity.variadic = true;
+            continue;
+        }
+        arity.total++;
+        if (!param.has_default) {
+            arity.required++;
+        }
+    }
+    return arity;
+}
+
+// "2", or "1 to 2" when some parameters have defaults
+std::string describe(const Arity& arity) {
+    if (arity.required == arity.total) {
+        return std::to_string(arity.total);
+    }
+    return std::to_string(arity.required) + " to " + std::to_string(arity.total);
+}
+
+bool isName(const TypeNode* type, const char* name) {
+    return type->kind == TypeNode::Kind::Name && type->name == name;
+}
+
+// Whether a type is made only of builtins, whose relations are known here.
+// Classes could be subclasses of each other through modules the analyzer
+// does not see, so types naming them are never reported.
+bool isBuiltin(const TypeNode* type) {
+    static const char* const names[] = {
+        "int", "float", "complex", "str", "bytes", "bool", "list", "dict", "tuple", "set", "frozenset",
+        "None", "Any", "object"
+    };
+    if (type->kind == TypeNode::Kind::Name || type->kind == TypeNode::Kind::Generic) {
+        bool known = false;
+        for (const char* name : names) {
+            known |= type->name == name;
+        }
+        if (!known) {
+            return false;
+        }
+    }
+    for (const TypeNode* arg : type->args) {
+        if (!isBuiltin(arg)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Whether a value of type from can be used where type to is expected.
+// Types are interned, so the common case of equal types of one module is
+// one comparison.
+bool assignable(const TypeNode* from, const TypeNode* to) {
+    if (sameType(from, to) || isName(from, "Any") || isName(to, "Any") || isName(to, "object")) {
+        return true;
+    }
+    if (from->kind == TypeNode::Kind::Union) {
+        for (const TypeNode* member : from->args) {
+            if (!assignable(member, to)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    if (to->kind == TypeNode::Kind::Union) {
+        for (const TypeNode* member : to->args) {
+            if (assignable(from, member)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    // The numeric tower of PEP 484, and bool is a subclass of int
+    if (from->kind == TypeNode::Kind::Name && to->kind == TypeNode::Kind::Name) {
+        return (from->name == "int" && (to->name == "float" || to->name == "complex")) ||
+               (from->name == "float" && to->name == "complex") ||
+               (from->name == "bool" && (to->name == "int" || to->name == "float" || to->name == "complex"));
+    }
+    // A bare list is list[Any]
+    if (from->kind == TypeNode::Kind::Name || to->kind == TypeNode::Kind::Name) {
+        return from->name == to->name;
+    }
+    // Same generic: containers are invariant, but for the immutable tuple
+    if (from->kind != to->kind || from->name != to->name || from->args.size() != to->args.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < from->args.size(); i++) {
+        const TypeNode* a = from->args[i];
+        const TypeNode* b = to->args[i];
+        if (from->name == "tuple" ? !assignable(a, b)
+                                  : !sameType(a, b) && !isName(a, "Any") && !isName(b, "Any")) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string qualified(const ClassInfo* cls, const MethodInfo& method) {
+    return cls ? cls->name + "." + method.name : method.name;
+}
+
+}
+
+std::string Diagnostic::toString() const {
+    static const char* const kinds[] = {
+        "unimplemented-abstract", "duplicate-method", "property-with-parameters", "override-arity",
+        "override-type"
+    };
+    return std::string(kinds[static_cast<int>(this->kind)]) + ": " + this->message;
+}
+
+const SemanticAnalyzer::Visible* SemanticAnalyzer::MethodTable::find(std::string_view name) const {
+    auto it = this->own.find(name);
+    return it != this->own.end() ? &it->second : inherited(name);
+}
+
+const SemanticAnalyzer::Visible* SemanticAnalyzer::MethodTable::inherited(std::string_view name) const {
+    for (auto it = ++this->mro.begin(); it != this->mro.end(); ++it) {
+        auto found = (*it)->own.find(name);
+        if (found != (*it)->own.end()) {
+            return &found->second;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<SemanticAnalyzer::Visible> SemanticAnalyzer::MethodTable::all() const {
+    std::vector<Visible> result;
+    std::unordered_set<std::string_view> names;
+    for (const MethodTable* table : this->mro) {
+        for (const auto& entry : table->own) {
+            if (names.insert(entry.first).second) {
+                result.push_back(entry.second);
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<Diagnostic> SemanticAnalyzer::analyze(const Outline& outline, const ImportedClasses* imported) {
+    size_t n = outline.classes.size();
+    this->outline = &outline;
+    this->imported = imported;
+    this->class_ids.clear();
+    this->visible.assign(n, MethodTable());
+    this->state.assign(n, 0);
+    this->has_children.assign(n, false);
+    this->has_imported.assign(n, false);
+    this->definers.clear();
+    this->diagnostics.clear();
+
+    // A name defined twice refers to its first definition
+    for (size_t i = 0; i < n; i++) {
+        this->class_ids.emplace(outline.classes[i].name, i);
+    }
+    for (const ClassInfo& cls : outline.classes) {
+        for (const MethodInfo& method : cls.methods) {
+            this->definers[method.name]++;
+        }
+        for (const std::string& parent : cls.parents) {
+            auto it = this->class_ids.find(parent);
+            if (it != this->class_ids.end() && &outline.classes[it->second] != &cls) {
+                this->has_children[it->second] = true;
+            }
+        }
+    }
+
+    checkMethods(nullptr, outline.functions);
+    for (size_t i = 0; i < n; i++) {
+        visit(i);
+    }
+    return std::move(this->diagnostics);
+}
+
+void SemanticAnalyzer::visit(size_t root) {
+    // Iterative post-order walk, deep hierarchies must not overflow the stack
+    std::vector<size_t> walk = {root};
+    while (!walk.empty()) {
+        size_t id = walk.back();
+        if (this->state[id] == 0) {
+            this->state[id] = 1;
+            // The leftmost parent on top, so parents finish left to right
+            const std::vector<std::string>& parents = this->outline->classes[id].parents;
+            for (auto parent = parents.rbegin(); parent != parents.rend(); ++parent) {
+                auto it = this->class_ids.find(*parent);
+                if (it != this->class_ids.end() && this->state[it->second] == 0) {
+                    walk.push_back(it->second);
+                }
+            }
+            continue;
+        }
+        walk.pop_back();
+        if (this->state[id] == 1) {
+            finish(id);
+            this->state[id] = 2;
+        }
+    }
+}
+
+// Builds the table of a class whose parents are done
+void SemanticAnalyzer::finish(size_t id) {
+    const ClassInfo& cls = this->outline->classes[id];
+    MethodTable& table = this->visible[id];
+
+    // Parents, the leftmost first. One still being visited is part of an
+    // inheritance cycle, which is cut there.
+    std::vector<const Linearization<const MethodTable*>*> bases;
+    for (const std::string& parent : cls.parents) {
+        auto it = this->class_ids.find(parent);
+        const MethodTable* base = nullptr;
+        if (it == this->class_ids.end()) {
+            if (this->imported) {
+                auto imported = this->imported->find(parent);
+                base = imported != this->imported->end() ? imported->second : nullptr;
+                this->has_imported[id] = this->has_imported[id] || base;
+            }
+        } else if (this->state[it->second] == 2) {
+            base = &this->visible[it->second];
+            this->has_imported[id] = this->has_imported[id] || this->has_imported[it->second];
+        }
+        if (base) {
+            bases.push_back(&base->mro);
+            table.abstract |= base->abstract;
+        }
+    }
+    bool inherits = !bases.empty();
+    table.mro.build(&table, std::move(bases));
+
+    checkMethods(&cls, cls.methods);
+
+    bool declares_abstract = false;
+    for (const MethodInfo& method : cls.methods) {
+        const Visible* base = nullptr;
+        if (inherits && (this->has_imported[id] || this->definers[method.name] > 1)) {
+            base = table.inherited(method.name);
+        }
+        if (base) {
+            checkOverride(cls, method, *base);
+        }
+        table.own[method.name] = {&method, &cls};
+        declares_abstract |= (method.decorators & DECORATOR_ABSTRACTMETHOD) != 0;
+    }
+    table.abstract |= declares_abstract;
+
+    if (!declares_abstract && !this->has_children[id] && table.abstract) {
+        std::vector<Visible> missing;
+        for (const Visible& v : table.all()) {
+            if (v.owner != &cls && (v.method->decorators & DECORATOR_ABSTRACTMETHOD)) {
+                missing.push_back(v);
+            }
+        }
+        std::sort(missing.begin(), missing.end(), [](const Visible& a, const Visible& b) {
+            return a.method->name < b.method->name;
+        });
+        for (const Visible& v : missing) {
+            report(Diagnostic::Kind::UnimplementedAbstract, &cls, *v.method,
+                   cls.name + " does not implement abstract method " + qualified(v.owner, *v.method));
+        }
+    }
+}
+
+void SemanticAnalyzer::checkMethods(const ClassInfo* owner, const std::vector<MethodInfo>& methods) {
+    std::unordered_set<std::string_view> seen;
+    for (const MethodInfo& method : methods) {
+        if (!seen.insert(method.name).second) {
+            report(Diagnostic::Kind::DuplicateMethod, owner, method,
+                   qualified(owner, method) + " is defined more than once");
+        }
+        if ((method.decorators & DECORATOR_PROPERTY) && method.params.size() > 1) {
+            report(Diagnostic::Kind::PropertyWithParameters, owner, method,
+                   "property " + qualified(owner, method) + " takes parameters besides self");
+        }
+    }
+}
+
+void SemanticAnalyzer::checkOverride(const ClassInfo& cls, const MethodInfo& method, const Visible& base) {
+    if (method.name == "__init__") {
+        return;  // Constructors usually differ
+    }
+    Arity mine = arityOf(method);
+    Arity theirs = arityOf(*base.method);
+    if (mine.variadic || theirs.variadic) {
+        return;
+    }
+    // Extra parameters with defaults are fine: every call that works on
+    // the base method still works on the override
+    if (mine.required > theirs.required || mine.total < theirs.total) {
+        report(Diagnostic::Kind::OverrideArity, &cls, method,
+               qualified(&cls, method) + " takes " + describe(mine) +
+               " parameters but overrides " + qualified(base.owner, *base.method) +
+               " which takes " + describe(theirs));
+    }
+    checkOverrideTypes(cls, method, base);
+}
+
+// Parameters are compared by position and have to accept what the base
+// method's accept; the return type has to be one the base method's
+// callers expect. Hints that are missing or name classes are skipped.
+void SemanticAnalyzer::checkOverrideTypes(const ClassInfo& cls, const MethodInfo& method, const Visible& base) {
+    const MethodInfo& theirs = *base.method;
+    size_t first = (method.decorators & DECORATOR_STATICMETHOD) ? 0 : 1;
+    for (size_t i = first; i < method.params.size() && i < theirs.params.size(); i++) {
+        const ParamInfo& mine = method.params[i];
+        const ParamInfo& other = theirs.params[i];
+        if (mine.stars != other.stars) {
+            break;
+        }
+        if (mine.type && other.type && isBuiltin(mine.type) && isBuiltin(other.type) &&
+            !assignable(other.type, mine.type)) {
+            report(Diagnostic::Kind::OverrideType, &cls, method,
+                   qualified(&cls, method) + " takes " + mine.name + ": " + mine.type->text +
+                   " but overrides " + qualified(base.owner, theirs) + " which takes " + other.name + ": " +
+                   other.type->text);
+        }
+    }
+    if (method.return_type && theirs.return_type && isBuiltin(method.return_type) &&
+        isBuiltin(theirs.return_type) && !assignable(method.return_type, theirs.return_type)) {
+        report(Diagnostic::Kind::OverrideType, &cls, method,
+               qualified(&cls, method) + " returns " + method.return_type->text + " but overrides " +
+               qualified(base.owner, theirs) + " which returns " + theirs.return_type->text);
+    }
+}
+
+void SemanticAnalyzer::report(Diagnostic::Kind kind, const ClassInfo* cls, const MethodInfo& method,
+                              std::string message) {
+    this->diagnostics.push_back({kind, cls ? cls->name : "", method.name, std::move(message)});
+}
@@ -0,0 +1,165 @@
+#include "Stats.h"
+#include <algorithm>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadStats*> live;  // Stats of running threads
+    Stats retired;             // Stats of threads that already exited
+};
+
+Registry& registry() {
+    static Registry r;
+    return r;
+}
+
+uint64_t valueOf(uint64_t value) {
+    return value;
+}
+
+uint64_t valueOf(const StatCounter& counter) {
+    return counter.load();
+}
+
+// Adds the counters of a Stats or a ThreadStats to total
+template <typename From>
+void addTo(Stats& total, const From& from) {
+    for (int i = 0; i < static_cast<int>(Phase::COUNT); i++) {
+        total.phase_ns[i] += valueOf(from.phase_ns[i]);
+        total.phase_calls[i] += valueOf(from.phase_calls[i]);
+    }
+    for (int i = 0; i < TAG_COUNT; i++) {
+        total.tokens_by_tag[i] += valueOf(from.tokens_by_tag[i]);
+    }
+    total.bytes_read += valueOf(from.bytes_read);
+    total.files_read += valueOf(from.files_read);
+    total.keyword_lookups += valueOf(from.keyword_lookups);
+    total.keyword_hits += valueOf(from.keyword_hits);
+    total.word_inserts += valueOf(from.word_inserts);
+    total.stream_regrowths += valueOf(from.stream_regrowths);
+}
+
+void clear(ThreadStats& stats) {
+    for (int i = 0; i < static_cast<int>(Phase::COUNT); i++) {
+        stats.phase_ns[i].clear();
+        stats.phase_calls[i].clear();
+    }
+    for (int i = 0; i < TAG_COUNT; i++) {
+        stats.tokens_by_tag[i].clear();
+    }
+    stats.bytes_read.clear();
+    stats.files_read.clear();
+    stats.keyword_lookups.clear();
+    stats.keyword_hits.clear();
+    stats.word_inserts.clear();
+    stats.stream_regrowths.clear();
+}
+
+const char* phaseName(int phase) {
+    static const char* const names[static_cast<int>(Phase::COUNT)] = {
+        "file_read", "indentation", "scan", "keyword_lookup", "stream_growth", "parse"
+    };
+    return names[phase];
+}
+
+}
+
+ThreadStats::~ThreadStats() {
+    if (!this->registered) {
+        return;
+    }
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.retired.merge(*this);
+    r.live.erase(std::remove(r.live.begin(), r.live.end(), this), r.live.end());
+}
+
+ThreadStats& Stats::local() {
+    thread_local ThreadStats stats;
+    if (!stats.registered) {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        r.live.push_back(&stats);
+        stats.registered = true;
+    }
+    return stats;
+}
+
+Stats Stats::snapshot() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    Stats total;
+    total.merge(r.retired);
+    for (const ThreadStats* s : r.live) {
+        total.merge(*s);
+    }
+    return total;
+}
+
+void Stats::resetAll() {
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.retired = Stats();
+    for (ThreadStats* s : r.live) {
+        clear(*s);
+    }
+}
+
+void Stats::merge(const Stats& other) {
+    addTo(*this, other);
+}
+
+void Stats::merge(const ThreadStats& other) {
+    addTo(*this, other);
+}
+
+std::string Stats::toJson() const {
+    std::string out = "{\n";
+#ifdef OOP_STATS
+    out += "  \"enabled\": true,\n";
+#else
+    out += "  \"enabled\": false,\n";
+#endif
+    out += "  \"phases\": {";
+    for (int i = 0; i < static_cast<int>(Phase::COUNT); i++) {
+        out += (i == 0 ? "\n" : ",\n");
+        out += "    \"" + std::string(phaseName(i)) + "\": {\"ns\": " + std::to_string(this->phase_ns[i]) +
+               ", \"calls\": " + std::to_string(this->phase_calls[i]) + "}";
+    }
+    out += "\n  },\n";
+    out += "  \"bytes_read\": " + std::to_string(this->bytes_read) + ",\n";
+    out += "  \"files_read\": " + std::to_string(this->files_read) + ",\n";
+    out += "  \"keyword_lookups\": " + std::to_string(this->keyword_lookups) + ",\n";
+    out += "  \"keyword_hits\": " + std::to_string(this->keyword_hits) + ",\n";
+    out += "  \"word_inserts\": " + std::to_string(this->word_inserts) + ",\n";
+    out += "  \"stream_regrowths\": " + std::to_string(this->stream_regrowths) + ",\n";
+
+    uint64_t total = 0;
+    out += "  \"tokens\": {";
+    bool first = true;
+    for (int i = 0; i < TAG_COUNT; i++) {
+        if (this->tokens_by_tag[i] == 0) {
+            continue;
+        }
+        total += this->tokens_by_tag[i];
+        out += (first ? "\n" : ",\n");
+        out += "    \"" + std::string(tagName(i)) + "\": " + std::to_string(this->tokens_by_tag[i]);
+        first = false;
+    }
+    out += (first ? "},\n" : "\n  },\n");
+    out += "  \"tokens_total\": " + std::to_string(total) + "\n";
+    out += "}\n";
+    return out;
+}
+
+PhaseTimer::~PhaseTimer() {
+    auto elapsed = std::chrono::steady_clock::now() - this->start;
+    ThreadStats& stats = Stats::local();
+    int i = static_cast<int>(this->phase);
+    stats.phase_ns[i] += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    ++stats.phase_calls[i];
+}
@@ -0,0 +1,119 @@
+#include "Str.h"
+#include <algorithm>
+
+namespace {
+
+void appendUtf8(std::string& out, char32_t cp) {
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+int hexDigit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Reads exactly digits hex digits of raw at i, moving i past them
+bool readHex(std::string_view raw, size_t& i, int digits, char32_t& cp) {
+    if (raw.size() - i < static_cast<size_t>(digits)) {
+        return false;
+    }
+    char32_t value = 0;
+    for (int d = 0; d < digits; d++) {
+        int digit = hexDigit(raw[i + d]);
+        if (digit < 0) {
+            return false;
+        }
+        value = value * 16 + static_cast<char32_t>(digit);
+    }
+    if (value > 0x10FFFF) {
+        return false;
+    }
+    i += digits;
+    cp = value;
+    return true;
+}
+
+}
+
+Str::Str(std::string_view raw, int tag) : Token(tag) {
+    this->raw = raw;
+}
+
+std::string Str::value() const {
+    if (raw.find('\\') == std::string_view::npos) {
+        return std::string(raw);
+    }
+    std::string str;
+    str.reserve(raw.size());
+    for (size_t i = 0; i < raw.size(); i++) {
+        if (raw[i] != '\\' || i + 1 == raw.size()) {
+            str += raw[i];
+            continue;
+        }
+        size_t escape = i++;
+        char32_t cp;
+        switch (raw[i]) {
+            case 'n': str += '\n'; break;
+            case 't': str += '\t'; break;
+            case 'r': str += '\r'; break;
+            case 'a': str += '\a'; break;
+            case 'b': str += '\b'; break;
+            case 'f': str += '\f'; break;
+            case 'v': str += '\v'; break;
+            case '\\': str += '\\'; break;
+            case '\'': str += '\''; break;
+            case '\"': str += '\"'; break;
+            case '\n': break;  // Line continuation
+            case '0': case '1': case '2': case '3':
+            case '4': case '5': case '6': case '7': {
+                cp = 0;
+                size_t end = std::min(raw.size(), i + 3);
+                for (; i < end && raw[i] >= '0' && raw[i] <= '7'; i++) {
+                    cp = cp * 8 + static_cast<char32_t>(raw[i] - '0');
+                }
+                i--;
+                appendUtf8(str, cp);
+                break;
+            }
+            case 'x':
+            case 'u':
+            case 'U': {
+                int digits = raw[i] == 'x' ? 2 : raw[i] == 'u' ? 4 : 8;
+                size_t digit = i + 1;
+                if (readHex(raw, digit, digits, cp)) {
+                    appendUtf8(str, cp);
+                    i = digit - 1;
+                } else {
+                    // Malformed, kept as written
+                    str.append(raw.substr(escape, 2));
+                }
+                break;
+            }
+            default:
+                // Unknown escapes (\d, \q, \N{...}) keep their backslash, as in Python
+                str += '\\';
+                str += raw[i];
+        }
+    }
+    return str;
+}
+
+std::string Str::toString() {
+    return value();
+}
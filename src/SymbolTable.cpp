@@ -0,0 +1,35 @@
+#include "SymbolTable.h"
+#include <cstring>
+#include <new>
+
+SymbolTable::SymbolTable(std::pmr::memory_resource* resource)
+    : resource(resource), pool(resource), tag_tokens(resource), words(resource) {
+    this->tag_tokens.reserve(TAG_COUNT);
+    for (int tag = 0; tag < TAG_COUNT; tag++) {
+        this->tag_tokens.emplace_back(tag);
+    }
+}
+
+std::shared_ptr<SymbolTable> SymbolTable::create(std::pmr::memory_resource* resource) {
+    return std::allocate_shared<SymbolTable>(std::pmr::polymorphic_allocator<SymbolTable>(resource), resource);
+}
+
+Word* SymbolTable::find(std::string_view lexeme) const {
+    auto it = this->words.find(lexeme);
+    return it != this->words.end() ? it->second : nullptr;
+}
+
+Word* SymbolTable::intern(std::string_view lexeme, int tag) {
+    if (Word* word = find(lexeme)) {
+        return word;
+    }
+    // Words only hold a view, so there is nothing to destroy: the pool
+    // takes their memory back with the table, and whatever a failed
+    // insertion allocated with it
+    char* chars = static_cast<char*>(this->pool.allocate(lexeme.size(), 1));
+    std::memcpy(chars, lexeme.data(), lexeme.size());
+    Word* word = ::new (this->pool.allocate(sizeof(Word), alignof(Word)))
+        Word(std::string_view(chars, lexeme.size()), tag);
+    this->words.emplace(word->lexeme, word);
+    return word;
+}
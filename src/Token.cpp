@@ -7,3 +7,22 @@ Token::Token(int t) {
 std::string Token::toString() {
     return std::string(1, static_cast<char>(this->tag));
 }
+
+const char* tagName(int tag) {
+    static const char* const names[TAG_COUNT] = {
+        "CLASS", "DEF", "SELF", "INIT", "SUPER", "NONE", "ANY", "TRUE", "FALSE",
+        "RETURN", "PASS", "IN", "IS", "IF", "ELIF", "ELSE", "FOR", "WHILE",
+        "BREAK", "CONTINUE",
+        "DECORATOR", "PROPERTY", "STATICMETHOD", "CLASSMETHOD", "ABSTRACTMETHOD", "CLS",
+        "COLON", "COMMA", "DOT", "OPEN_PARENTHESIS", "CLOSE_PARENTHESIS",
+        "OPEN_BRACKET", "CLOSE_BRACKET", "OPEN_BRACE", "CLOSE_BRACE", "ASSIGN", "ARROW",
+        "INDENT", "DEDENT", "NEWLINE",
+        "TYPE", "VARIABLE", "NUM", "STRING", "DOCSTRING",
+        "LOGIC_OP", "PLUS", "MINUS", "MULT", "DIV", "MOD", "AND", "OR", "NOT",
+        "FROM", "IMPORT"
+    };
+    if (tag < 0 || tag >= TAG_COUNT) {
+        return "UNKNOWN";
+    }
+    return names[tag];
+}
@@ -0,0 +1,265 @@
+#include "TokenSerializer.h"
+#include "MappedFile.h"
+#include "Num.h"
+#include "Str.h"
+#include "Word.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+const uint32_t TOKEN_FILE_VERSION = 1;
+
+enum Payload : unsigned { PLAIN, WORD, NUMBER, STRING };
+enum NumberKind : uint8_t { INT, FLOAT, IMAGINARY, BIG_INT };
+
+void putVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out += static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+void putDouble(std::string& out, double value) {
+    char bytes[sizeof(double)];
+    std::memcpy(bytes, &value, sizeof(double));
+    out.append(bytes, sizeof(double));
+}
+
+void putU32(std::string& out, uint32_t value) {
+    char bytes[sizeof(uint32_t)];
+    std::memcpy(bytes, &value, sizeof(uint32_t));
+    out.append(bytes, sizeof(uint32_t));
+}
+
+class Reader {
+public:
+    Reader(const char* begin, const char* end) : cursor(begin), end(end) {}
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t byte = this->byte();
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if (!(byte & 0x80)) {
+                return value;
+            }
+        }
+        throw std::runtime_error("Corrupt token file: varint too long");
+    }
+
+    uint8_t byte() {
+        need(1);
+        return static_cast<uint8_t>(*this->cursor++);
+    }
+
+    double real() {
+        need(sizeof(double));
+        double value;
+        std::memcpy(&value, this->cursor, sizeof(double));
+        this->cursor += sizeof(double);
+        return value;
+    }
+
+private:
+    const char* cursor;
+    const char* end;
+
+    void need(size_t n) {
+        if (static_cast<size_t>(this->end - this->cursor) < n) {
+            throw std::runtime_error("Corrupt token file: truncated");
+        }
+    }
+};
+
+// Interns the lexemes and literal texts of a stream while serializing
+class StringTable {
+public:
+    uint32_t intern(std::string_view s) {
+        auto it = this->ids.find(s);
+        if (it != this->ids.end()) {
+            return it->second;
+        }
+        uint32_t id = static_cast<uint32_t>(this->strings.size());
+        this->strings.push_back(s);
+        this->ids.emplace(s, id);
+        return id;
+    }
+
+    const std::vector<std::string_view>& all() const { return this->strings; }
+
+private:
+    // Views into the tokens, which outlive the serialization
+    std::unordered_map<std::string_view, uint32_t> ids;
+    std::vector<std::string_view> strings;
+};
+
+}
+
+void serializeTokens(const TokenStream& stream, std::string& out) {
+    StringTable table;
+    std::string code;
+    code.reserve(stream.size() * 2);
+
+    for (size_t i = 0; i < stream.size(); i++) {
+        Token* token = stream.at(i);
+        uint64_t tag = static_cast<uint64_t>(token->tag) << 2;
+        if (Word* word = dynamic_cast<Word*>(token)) {
+            putVarint(code, tag | WORD);
+            putVarint(code, table.intern(word->lexeme));
+        } else if (Str* str = dynamic_cast<Str*>(token)) {
+            putVarint(code, tag | STRING);
+            putVarint(code, table.intern(str->raw));
+        } else if (Num* num = dynamic_cast<Num*>(token)) {
+            putVarint(code, tag | NUMBER);
+            if (num->kind == Num::Kind::Int && !num->big) {
+                code += static_cast<char>(INT);
+                // Zigzag so small negative values stay short
+                uint64_t v = static_cast<uint64_t>(num->value);
+                putVarint(code, (v << 1) ^ (num->value < 0 ? ~uint64_t(0) : 0));
+            } else {
+                code += static_cast<char>(num->big ? BIG_INT
+                                          : num->kind == Num::Kind::Float ? FLOAT : IMAGINARY);
+                putDouble(code, num->real);
+            }
+        } else {
+            putVarint(code, tag | PLAIN);
+        }
+    }
+
+    const std::vector<std::string_view>& strings = table.all();
+    size_t string_bytes = 0;
+    for (std::string_view s : strings) {
+        string_bytes += s.size();
+    }
+
+    TokenFileHeader header;
+    std::memcpy(header.magic, "OOPT", 4);
+    header.version = TOKEN_FILE_VERSION;
+    header.token_count = static_cast<uint32_t>(stream.size());
+    header.string_count = static_cast<uint32_t>(strings.size());
+    header.string_bytes = static_cast<uint32_t>(string_bytes);
+    header.code_bytes = static_cast<uint32_t>(code.size());
+
+    out.reserve(out.size() + sizeof(header) + (strings.size() + 1) * sizeof(uint32_t) + string_bytes + code.size());
+    out.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    uint32_t offset = 0;
+    for (std::string_view s : strings) {
+        putU32(out, offset);
+        offset += static_cast<uint32_t>(s.size());
+    }
+    putU32(out, offset);
+    for (std::string_view s : strings) {
+        out += s;
+    }
+    out += code;
+}
+
+void saveTokens(const TokenStream& stream, const std::string& path) {
+    std::string data;
+    serializeTokens(stream, data);
+    std::ofstream out(path, std::ios::binary);
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!out) {
+        throw std::runtime_error("Could not write file " + path);
+    }
+}
+
+void deserializeTokens(std::shared_ptr<const void> owner, std::string_view data, TokenStream& stream) {
+    TokenFileHeader header;
+    if (data.size() < sizeof(header)) {
+        throw std::runtime_error("Not a token file");
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, "OOPT", 4) != 0 || header.version != TOKEN_FILE_VERSION) {
+        throw std::runtime_error("Not a token file");
+    }
+    size_t offsets_bytes = (static_cast<size_t>(header.string_count) + 1) * sizeof(uint32_t);
+    if (data.size() - sizeof(header) < offsets_bytes + header.string_bytes + header.code_bytes) {
+        throw std::runtime_error("Corrupt token file: truncated");
+    }
+    const char* offsets = data.data() + sizeof(header);
+    const char* strings = offsets + offsets_bytes;
+    const char* code = strings + header.string_bytes;
+
+    auto string = [&](uint64_t id) {
+        if (id >= header.string_count) {
+            throw std::runtime_error("Corrupt token file: bad string id");
+        }
+        uint32_t range[2];
+        std::memcpy(range, offsets + id * sizeof(uint32_t), sizeof(range));
+        if (range[0] > range[1] || range[1] > header.string_bytes) {
+            throw std::runtime_error("Corrupt token file: bad string offset");
+        }
+        return std::string_view(strings + range[0], range[1] - range[0]);
+    };
+
+    stream.clear();
+    stream.retain(std::move(owner));
+
+    // Tokens without payload and Words are shared inside the stream, like
+    // the lexer shares them. The lookup tables are scratch memory of the
+    // same resource as the stream.
+    std::pmr::vector<Token*> plain(TAG_COUNT, nullptr, stream.resource());
+    std::pmr::unordered_map<uint64_t, Token*> words(stream.resource());
+
+    Reader reader(code, code + header.code_bytes);
+    for (uint32_t i = 0; i < header.token_count; i++) {
+        uint64_t head = reader.varint();
+        uint64_t tag = head >> 2;
+        if (tag >= static_cast<uint64_t>(TAG_COUNT)) {
+            throw std::runtime_error("Corrupt token file: bad tag");
+        }
+        int t = static_cast<int>(tag);
+        switch (head & 3) {
+        case PLAIN:
+            if (!plain[t]) {
+                plain[t] = stream.make<Token>(t);
+            }
+            stream.add(plain[t]);
+            break;
+        case WORD: {
+            uint64_t id = reader.varint();
+            Token*& word = words[id * TAG_COUNT + tag];
+            if (!word) {
+                word = stream.make<Word>(string(id), t);
+            }
+            stream.add(word);
+            break;
+        }
+        case STRING:
+            stream.add(stream.make<Str>(string(reader.varint()), t));
+            break;
+        case NUMBER: {
+            uint8_t kind = reader.byte();
+            Num* num;
+            if (kind == INT) {
+                uint64_t v = reader.varint();
+                num = stream.make<Num>(static_cast<long long>((v >> 1) ^ (~(v & 1) + 1)));
+            } else if (kind == BIG_INT) {
+                num = stream.make<Num>(0LL);
+                num->big = true;
+                num->real = reader.real();
+            } else if (kind == FLOAT || kind == IMAGINARY) {
+                num = stream.make<Num>(reader.real(), kind == FLOAT ? Num::Kind::Float : Num::Kind::Imaginary);
+            } else {
+                throw std::runtime_error("Corrupt token file: bad number kind");
+            }
+            num->tag = t;
+            stream.add(num);
+            break;
+        }
+        }
+    }
+    stream.reset();
+}
+
+void loadTokens(const std::string& path, TokenStream& stream) {
+    auto mapping = std::make_shared<MappedFile>(path);
+    std::string_view data = mapping->view();
+    deserializeTokens(std::move(mapping), data, stream);
+}
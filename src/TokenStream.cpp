@@ -1,27 +1,85 @@
 #include "TokenStream.h"
+#include "Stats.h"
 
-void TokenStream::addToken(Token* token) {
-    tokens.push_back(std::unique_ptr<Token>(token));
+TokenStream::TokenStream(std::pmr::memory_resource* resource)
+    : tokens(resource), owned(resource), retained(resource) {
+}
+
+TokenStream::~TokenStream() {
+    clear();
+}
+
+void TokenStream::adopt(const Owned& token) {
+    try {
+        owned.push_back(token);
+    } catch (...) {
+        destroy(token);
+        throw;
+    }
+}
+
+void TokenStream::destroy(const Owned& token) {
+    token.token->~Token();
+    token.resource->deallocate(token.token, token.size, token.alignment);
+}
+
+void TokenStream::add(Token* token) {
+#ifdef OOP_STATS
+    // Only time the push_backs that reallocate, timing every token would
+    // cost more than the push_back itself
+    if (tokens.size() == tokens.capacity()) {
+        STATS_TIMER(Phase::StreamGrowth);
+        STATS_ADD(stream_regrowths, 1);
+        tokens.push_back(token);
+        return;
+    }
+#endif
+    tokens.push_back(token);
+}
+
+void TokenStream::retain(std::shared_ptr<const void> owner) {
+    retained.push_back(std::move(owner));
+}
+
+void TokenStream::append(TokenStream&& other) {
+    tokens.insert(tokens.end(), other.tokens.begin(), other.tokens.end());
+    owned.insert(owned.end(), other.owned.begin(), other.owned.end());
+    // The tokens are this stream's now, other must not free them
+    other.owned.clear();
+    for (auto& owner : other.retained) {
+        retained.push_back(std::move(owner));
+    }
+    other.clear();
 }
 
 Token* TokenStream::peek() const {
     if (current_pos >= tokens.size()) {
         return nullptr;
     }
-    return tokens[current_pos].get();
+    return tokens[current_pos];
 }
 
 Token* TokenStream::next() {
     if (current_pos >= tokens.size()) {
         return nullptr;
     }
-    return tokens[current_pos++].get();
+    return tokens[current_pos++];
 }
 
 void TokenStream::reset() {
     current_pos = 0;
 }
 
+void TokenStream::clear() {
+    tokens.clear();
+    for (const Owned& token : owned) {
+        destroy(token);
+    }
+    owned.clear();
+    retained.clear();
+    current_pos = 0;
+}
+
 size_t TokenStream::size() const {
     return tokens.size();
 }
@@ -30,7 +88,7 @@ Token* TokenStream::at(size_t pos) const {
     if (pos >= tokens.size()) {
         return nullptr;
     }
-    return tokens[pos].get();
+    return tokens[pos];
 }
 
 size_t TokenStream::position() const {
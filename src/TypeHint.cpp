@@ -0,0 +1,148 @@
+#include "TypeHint.h"
+#include <algorithm>
+#include <functional>
+
+namespace {
+
+size_t combine(size_t seed, size_t value) {
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+void appendArgs(const std::vector<const TypeNode*>& args, std::string& out) {
+    for (size_t i = 0; i < args.size(); i++) {
+        if (i > 0) {
+            out += ", ";
+        }
+        out += args[i]->text;
+    }
+}
+
+}
+
+bool TypeTable::Equal::operator()(const TypeNode* a, const TypeNode* b) const {
+    // Arguments are interned already, so comparing their pointers is enough
+    return a->kind == b->kind && a->name == b->name && a->args == b->args;
+}
+
+bool sameType(const TypeNode* a, const TypeNode* b) {
+    if (a == b) {
+        return true;
+    }
+    // Hashes are computed from the contents alone, so they agree across tables
+    if (a->hash != b->hash || a->kind != b->kind || a->name != b->name || a->args.size() != b->args.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a->args.size(); i++) {
+        if (!sameType(a->args[i], b->args[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+const TypeNode* TypeTable::name(std::string_view dotted) {
+    return intern(TypeNode::Kind::Name, dotted, {});
+}
+
+const TypeNode* TypeTable::generic(std::string_view dotted, std::vector<const TypeNode*> args) {
+    std::string_view bare = dotted.substr(dotted.compare(0, 7, "typing.") == 0 ? 7 : 0);
+    if (bare == "Optional" && args.size() == 1) {
+        args.push_back(name("None"));
+        return unionOf(std::move(args));
+    }
+    if (bare == "Union" && !args.empty()) {
+        return unionOf(std::move(args));
+    }
+    return intern(TypeNode::Kind::Generic, dotted, std::move(args));
+}
+
+const TypeNode* TypeTable::unionOf(std::vector<const TypeNode*> members) {
+    std::vector<const TypeNode*> flat;
+    for (const TypeNode* member : members) {
+        if (member->kind == TypeNode::Kind::Union) {
+            flat.insert(flat.end(), member->args.begin(), member->args.end());
+        } else {
+            flat.push_back(member);
+        }
+    }
+    // Sorting by text, not by address, keeps the spelling the same from run to run
+    std::sort(flat.begin(), flat.end(), [](const TypeNode* a, const TypeNode* b) { return a->text < b->text; });
+    flat.erase(std::unique(flat.begin(), flat.end()), flat.end());
+    if (flat.size() == 1) {
+        return flat[0];
+    }
+    return intern(TypeNode::Kind::Union, "", std::move(flat));
+}
+
+const TypeNode* TypeTable::list(std::vector<const TypeNode*> items) {
+    return intern(TypeNode::Kind::List, "", std::move(items));
+}
+
+const TypeNode* TypeTable::ellipsis() {
+    return intern(TypeNode::Kind::Ellipsis, "", {});
+}
+
+const TypeNode* TypeTable::adopt(const TypeNode* node) {
+    // Arguments are adopted first; those of a union are flattened and
+    // sorted already, so the node is interned as it is
+    std::vector<const TypeNode*> args;
+    args.reserve(node->args.size());
+    for (const TypeNode* arg : node->args) {
+        args.push_back(adopt(arg));
+    }
+    return intern(node->kind, node->name, std::move(args));
+}
+
+const TypeNode* TypeTable::intern(TypeNode::Kind kind, std::string_view name, std::vector<const TypeNode*> args) {
+    TypeNode probe{kind, std::string(name), std::move(args), std::string(), 0};
+    size_t hash = combine(std::hash<std::string_view>()(name), static_cast<size_t>(kind));
+    for (const TypeNode* arg : probe.args) {
+        hash = combine(hash, arg->hash);
+    }
+    probe.hash = hash;
+
+    auto it = this->index.find(&probe);
+    if (it != this->index.end()) {
+        return *it;
+    }
+
+    switch (kind) {
+        case TypeNode::Kind::Name:
+            probe.text = probe.name;
+            break;
+        case TypeNode::Kind::Generic:
+            probe.text = probe.name + "[";
+            appendArgs(probe.args, probe.text);
+            probe.text += "]";
+            break;
+        case TypeNode::Kind::Union: {
+            // Optional[X] for a union of one type and None
+            const TypeNode* none = nullptr;
+            for (const TypeNode* member : probe.args) {
+                if (member->kind == TypeNode::Kind::Name && member->name == "None") {
+                    none = member;
+                }
+            }
+            if (none && probe.args.size() == 2) {
+                probe.text = "Optional[" + (probe.args[0] == none ? probe.args[1] : probe.args[0])->text + "]";
+            } else {
+                probe.text = "Union[";
+                appendArgs(probe.args, probe.text);
+                probe.text += "]";
+            }
+            break;
+        }
+        case TypeNode::Kind::List:
+            probe.text = "[";
+            appendArgs(probe.args, probe.text);
+            probe.text += "]";
+            break;
+        case TypeNode::Kind::Ellipsis:
+            probe.text = "...";
+            break;
+    }
+    this->nodes.push_back(std::move(probe));
+    const TypeNode* node = &this->nodes.back();
+    this->index.insert(node);
+    return node;
+}
@@ -0,0 +1,69 @@
+#include "Unicode.h"
+#include <algorithm>
+
+namespace {
+
+bool inRanges(const UnicodeRange* ranges, size_t size, char32_t cp) {
+    // First range ending at or after cp, then whether it starts before cp
+    const UnicodeRange* end = ranges + size;
+    const UnicodeRange* it = std::lower_bound(ranges, end, cp,
+        [](const UnicodeRange& range, char32_t value) { return range.last < value; });
+    return it != end && it->first <= cp;
+}
+
+bool isContinuationByte(char c) {
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+}
+
+int decodeUtf8(const char* p, const char* end, char32_t& cp) {
+    unsigned char lead = static_cast<unsigned char>(*p);
+    int length;
+    char32_t min;
+    if (lead < 0x80) {
+        cp = lead;
+        return 1;
+    } else if ((lead & 0xE0) == 0xC0) {
+        length = 2;
+        min = 0x80;
+        cp = lead & 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        length = 3;
+        min = 0x800;
+        cp = lead & 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        length = 4;
+        min = 0x10000;
+        cp = lead & 0x07;
+    } else {
+        return 0;
+    }
+    if (end - p < length) {
+        return 0;
+    }
+    for (int i = 1; i < length; i++) {
+        if (!isContinuationByte(p[i])) {
+            return 0;
+        }
+        cp = (cp << 6) | (static_cast<unsigned char>(p[i]) & 0x3F);
+    }
+    if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+        return 0;
+    }
+    return length;
+}
+
+bool isXidStart(char32_t cp) {
+    if (cp < 0x80) {
+        return isAsciiIdentStart(static_cast<char>(cp)) && cp != '_';
+    }
+    return inRanges(XID_START, XID_START_SIZE, cp);
+}
+
+bool isXidContinue(char32_t cp) {
+    if (cp < 0x80) {
+        return isAsciiIdentContinue(static_cast<char>(cp));
+    }
+    return inRanges(XID_CONTINUE, XID_CONTINUE_SIZE, cp);
+}
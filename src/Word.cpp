@@ -1,11 +1,9 @@
 #include "Word.h"
 
-Word::Word(std::string s, int tag) : Token(tag) {
-    this->lexeme = s;
-}
+Word::Word(std::string_view s, int tag) : Token(tag), lexeme(s) {}
 
 std::string Word::toString() {
-    return lexeme;
+    return std::string(lexeme);
 }
 
 // Initialize static constants
@@ -1,23 +1,680 @@
+#include "ClassIndex.h"
+#include "IndexQuery.h"
+#include "Emitter.h"
+#include "FileLoader.h"
+#include "LL1Parser.h"
+#include "LalrParser.h"
 #include "Lexer.h"
+#include "ParallelLexer.h"
+#include "Project.h"
 #include "RecursiveDescendant.h"
+#include "SemanticAnalyzer.h"
+#include "Dataset.h"
+#include "BatchResults.h"
+#include "Stats.h"
+#include "TokenSerializer.h"
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+static void usage(const char* program) {
+    std::cerr << "Usage: " << program << " [--stats[=file]] [--jobs=N] [--tab-width=N] [--scanner=hand|table] [--bodies] [--check] [--save-tokens=<file.tok>] <python_file>" << std::endl;
+    std::cerr << "       " << program << " [--stats[=file]] [--check] --load-tokens <file.tok>" << std::endl;
+    std::cerr << "       " << program << " --emit=tokens|outline|json|bin|ast [--bodies] [--load-tokens] <file>..." << std::endl;
+    std::cerr << "       " << program << " [--stats[=file]] [--bodies] --jsonl=<dataset.jsonl[.gz]>" << std::endl;
+    std::cerr << "       " << program << " --verdicts [--bodies] [--shard=i/N] [--results=<out.jsonl>] [--jsonl=<dataset.jsonl[.gz]>] <file_or_dir>..." << std::endl;
+    std::cerr << "       " << program << " --merge=<out.jsonl> <shard.jsonl>..." << std::endl;
+    std::cerr << "       " << program << " --compare-parsers [--jsonl=<dataset.jsonl[.gz]>] <file_or_dir>..." << std::endl;
+    std::cerr << "       " << program << " --build-index=<out.idx> [--jobs=N] [--io=auto|uring|threads] <file_or_dir>..." << std::endl;
+    std::cerr << "       " << program << " --project [--jobs=N] [--io=auto|uring|threads] [--deps] <file_or_dir>..." << std::endl;
+    std::cerr << "       " << program << " --index=<file.idx> (--subclasses=<Class> | --unimplemented-abstract | --query=<key=value,...>)" << std::endl;
+}
+
+// Validates every correct_code snippet of a JSONL dataset in process,
+// reusing one lexer and parser for all of them. The tokens of each snippet
+// go to an arena on the stack that is dropped at once after it. With
+// bodies, a snippet is only valid if its method bodies parse too.
+static int runDataset(const std::string& path, int tab_width, ScannerBackend backend, bool bodies) {
+    DatasetReader reader(path);
+    Lexer lexer;
+    lexer.setTabWidth(tab_width);
+    lexer.setScanner(backend);
+    RecursiveDescendant parser(nullptr);
+    parser.setParseBodies(bodies);
+    // Snippets are decoded straight into the buffer the lexer scans
+    auto code = std::make_shared<std::string>();
+    size_t total = 0;
+    size_t valid = 0;
+    alignas(std::max_align_t) char arena[64 * 1024];
+
+    while (reader.next(*code)) {
+        total++;
+        // Larger snippets go on to the heap once the arena is full
+        std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena));
+        TokenStream stream(&resource);
+        try {
+            lexer.resetBuffer(code);
+            lexer.generateStream(stream);
+            parser.reset(&stream);
+            parser.parse();
+            valid++;
+        } catch (const std::runtime_error&) {
+            // Invalid snippet, only counted
+        }
+    }
+    std::cout << "Snippets: " << total << "\nValid: " << valid << "\n";
+    return 0;
+}
+
+// Adds path, or every .py file under it if it is a directory, to files
+static void collectPythonFiles(const std::string& path, std::vector<std::string>& files) {
+    namespace fs = std::filesystem;
+    if (!fs::is_directory(path)) {
+        files.push_back(path);
+        return;
+    }
+    std::vector<std::string> found;
+    for (const auto& entry : fs::recursive_directory_iterator(path, fs::directory_options::skip_permission_denied)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".py") {
+            found.push_back(entry.path().string());
+        }
+    }
+    // Same index for the same tree, whatever the directory order
+    std::sort(found.begin(), found.end());
+    files.insert(files.end(), found.begin(), found.end());
+}
+
+// Lexes every input (files, the .py files under directories and the
+// snippets of a dataset) once, then parses all of them with each parsing
+// engine, best of a few passes. The engines must accept and reject the
+// same inputs; returns 1 if they do not.
+static int compareParsers(const std::vector<std::string>& inputs, const std::string& dataset, int tab_width,
+                          ScannerBackend backend) {
+    constexpr int RUNS = 5;
+    std::vector<std::string> names;
+    for (const std::string& input : inputs) {
+        collectPythonFiles(input, names);
+    }
+
+    Lexer lexer;
+    lexer.setTabWidth(tab_width);
+    lexer.setScanner(backend);
+    std::vector<std::string> lexed;
+    std::vector<std::unique_ptr<TokenStream>> streams;
+    size_t tokens = 0;
+    size_t lex_errors = 0;
+    auto add = [&](const std::string& name) {
+        auto stream = std::make_unique<TokenStream>();
+        try {
+            lexer.generateStream(*stream);
+        } catch (const std::runtime_error&) {
+            lex_errors++;
+            return;
+        }
+        tokens += stream->size();
+        lexed.push_back(name);
+        streams.push_back(std::move(stream));
+    };
+    for (const std::string& name : names) {
+        lexer.reset(name);
+        add(name);
+    }
+    if (!dataset.empty()) {
+        DatasetReader reader(dataset);
+        std::string code;
+        while (reader.next(code)) {
+            lexer.resetText(code);
+            add(dataset + ":" + std::to_string(reader.lineNumber()));
+        }
+    }
+
+    struct Engine {
+        const char* name;
+        std::unique_ptr<Parser> parser;
+        std::vector<bool> accepted;
+    };
+    Engine engines[] = {
+        {"recursive-descent", std::make_unique<RecursiveDescendant>(nullptr), {}},
+        {"lalr", std::make_unique<LalrParser>(nullptr), {}},
+        {"ll1", std::make_unique<LL1Parser>(nullptr), {}},
+    };
+
+    std::cout << "Inputs: " << lexed.size() << " (" << lex_errors << " with lexical errors left out)\n"
+              << "Tokens: " << tokens << "\n";
+    for (Engine& engine : engines) {
+        engine.accepted.assign(streams.size(), false);
+        double best = 0;
+        for (int run = 0; run < RUNS; run++) {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < streams.size(); i++) {
+                try {
+                    engine.parser->reset(streams[i].get());
+                    engine.parser->parse();
+                    engine.accepted[i] = true;
+                } catch (const std::runtime_error&) {
+                    engine.accepted[i] = false;
+                }
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            best = run == 0 ? elapsed.count() : std::min(best, elapsed.count());
+        }
+        size_t accepted = std::count(engine.accepted.begin(), engine.accepted.end(), true);
+        std::printf("%-18s accepted %8zu  %9.4f s  %8.1f Mtokens/s\n", engine.name, accepted, best,
+                    best > 0 ? tokens / best / 1e6 : 0.0);
+    }
+    std::fflush(stdout);
+
+    size_t disagreements = 0;
+    for (size_t i = 0; i < streams.size(); i++) {
+        bool differs = false;
+        for (const Engine& engine : engines) {
+            differs = differs || engine.accepted[i] != engines[0].accepted[i];
+        }
+        if (!differs) {
+            continue;
+        }
+        disagreements++;
+        std::cerr << "Disagreement: " << lexed[i] << ":";
+        for (const Engine& engine : engines) {
+            std::cerr << " " << engine.name << (engine.accepted[i] ? "=accept" : "=reject");
+        }
+        std::cerr << std::endl;
+    }
+    std::cout << "Disagreements: " << disagreements << "\n";
+    return disagreements == 0 ? 0 : 1;
+}
+
+static int buildIndex(const std::string& output, const std::vector<std::string>& inputs, unsigned jobs,
+                      FileLoader::Backend io) {
+    std::vector<std::string> files;
+    for (const std::string& input : inputs) {
+        collectPythonFiles(input, files);
+    }
+    ClassIndexBuilder builder;
+    size_t failed = builder.addFiles(files, jobs, io);
+    builder.write(output);
+    std::cout << "Files: " << files.size() << "\nFailed: " << failed
+              << "\nClasses: " << builder.classCount() << "\n";
+    return 0;
+}
+
+// Analyzes the inputs as one project, checking each module with the
+// classes it imports from the others. Prints the diagnostics of every
+// module, or with deps the modules each one imports; returns 1 if there are
+// diagnostics.
+static int analyzeProject(const std::vector<std::string>& inputs, unsigned jobs, FileLoader::Backend io, bool deps) {
+    Project project;
+    for (const std::string& input : inputs) {
+        project.addRoot(input);
+    }
+    project.analyze(jobs, io);
+
+    const std::vector<Module>& modules = project.modules();
+    size_t imports = 0;
+    size_t failed = 0;
+    size_t diagnostics = 0;
+    for (const Module& module : modules) {
+        imports += module.imports.size();
+        if (!module.error.empty()) {
+            failed++;
+            std::cerr << "Error: " << module.path << ": " << module.error << std::endl;
+        }
+        if (deps) {
+            std::cout << module.name << " ->";
+            for (uint32_t dependency : module.imports) {
+                std::cout << " " << modules[dependency].name;
+            }
+            std::cout << "\n";
+            continue;
+        }
+        for (const Diagnostic& diagnostic : module.diagnostics) {
+            std::cout << module.path << ": " << diagnostic.toString() << "\n";
+        }
+        diagnostics += module.diagnostics.size();
+    }
+    std::cout << "Modules: " << modules.size() << "\nImports: " << imports << "\nFailed: " << failed << "\n";
+    return diagnostics == 0 ? 0 : 1;
+}
+
+static int queryIndex(const std::string& path, const std::string& subclasses_of, bool unimplemented,
+                      const std::string& query_text) {
+    // A bad query fails before the index is mapped
+    IndexQuery query = query_text.empty() ? IndexQuery() : IndexQuery::parse(query_text);
+    ClassIndex index(path);
+    if (!query_text.empty()) {
+        for (uint32_t id : query.run(index)) {
+            if (query.findsMethods()) {
+                uint32_t cls = index.method(id).cls;
+                std::cout << index.name(cls) << "." << index.methodName(id) << "\t" << index.file(cls) << "\n";
+            } else {
+                std::cout << index.name(id) << "\t" << index.file(id) << "\n";
+            }
+        }
+    } else if (unimplemented) {
+        for (const ClassIndex::Unimplemented& u : index.unimplementedAbstract()) {
+            std::cout << index.name(u.cls) << " (" << index.file(u.cls) << "): " << u.method
+                      << " from " << index.name(u.declared_in) << "\n";
+        }
+    } else {
+        for (uint32_t cls : index.subclasses(subclasses_of)) {
+            std::cout << index.name(cls) << "\t" << index.file(cls) << "\n";
+        }
+    }
+    return 0;
+}
+
+// Prints the semantic diagnostics of a parsed file; returns 1 if any
+static int check(const RecursiveDescendant& parser) {
+    SemanticAnalyzer analyzer;
+    std::vector<Diagnostic> diagnostics = analyzer.analyze(parser.outline());
+    for (const Diagnostic& diagnostic : diagnostics) {
+        std::cout << diagnostic.toString() << "\n";
+    }
+    return diagnostics.empty() ? 0 : 1;
+}
+
+// Writes out to stdout in one call and empties it for the next file
+static void writeOutput(std::string& out) {
+    std::fwrite(out.data(), 1, out.size(), stdout);
+    out.clear();
+}
+
+// Emits every input in the given mode, reusing one lexer, stream, parser
+// and output buffer. Token modes only lex; outline modes also parse, and a
+// file with a syntax error still emits what was recognized before it.
+static int emitFiles(const std::vector<std::string>& inputs, EmitMode mode, bool load_tokens, int tab_width,
+                     ScannerBackend backend, bool bodies) {
+    Lexer lexer;
+    lexer.setTabWidth(tab_width);
+    lexer.setScanner(backend);
+    TokenStream stream;
+    RecursiveDescendant parser(nullptr);
+    parser.setParseBodies(bodies || mode == EmitMode::Ast);
+    std::string out;
+    out.reserve(1 << 20);
+    int status = 0;
+
+    for (const std::string& input : inputs) {
+        try {
+            if (load_tokens) {
+                loadTokens(input, stream);
+            } else {
+                lexer.reset(input);
+                lexer.generateStream(stream);
+            }
+        } catch (const std::runtime_error& e) {
+            std::cerr << "Error: " << input << ": " << e.what() << std::endl;
+            status = 1;
+            continue;
+        }
+
+        if (mode == EmitMode::Tokens) {
+            emitTokens(stream, out);
+        } else if (mode == EmitMode::Binary) {
+            serializeTokens(stream, out);
+        } else {
+            std::string error;
+            try {
+                parser.reset(&stream);
+                parser.parse();
+            } catch (const std::runtime_error& e) {
+                error = e.what();
+                std::cerr << "Error: " << input << ": " << error << std::endl;
+                status = 1;
+            }
+            if (mode == EmitMode::Json) {
+                emitJson(input, parser.outline(), error, out);
+            } else if (mode == EmitMode::Ast) {
+                emitAst(parser.outline(), stream, out);
+            } else {
+                emitOutline(parser.outline(), out);
+            }
+        }
+        writeOutput(out);
+    }
+    return status;
+}
+
+// Prints, for every input (files, the .py files under directories and the
+// snippets of a dataset), whether the parser accepts it and how long it
+// took, one line each: accept|reject, nanoseconds (best of a few runs, the
+// file already in memory), name (path, or dataset:line) and the error if
+// rejected, separated by tabs. scripts/ast_conformance.py compares these
+// with CPython. With a shard, only the inputs of that shard are judged; with
+// a results path, they are written there in the mergeable format of
+// BatchResults.h instead.
+static int printVerdicts(const std::vector<std::string>& inputs, const std::string& dataset, int tab_width,
+                         ScannerBackend backend, bool bodies, const Shard& shard, const std::string& results_path) {
+    constexpr int RUNS = 3;
+    Lexer lexer;
+    lexer.setTabWidth(tab_width);
+    lexer.setScanner(backend);
+    RecursiveDescendant parser(nullptr);
+    parser.setParseBodies(bodies);
+    TokenStream stream;
+    std::string out;
+    out.reserve(1 << 20);
+    std::vector<BatchResult> results;
+
+    auto judge = [&](const std::string& name, const std::shared_ptr<std::string>& code) {
+        std::string error;
+        int64_t best = 0;
+        for (int run = 0; run < RUNS; run++) {
+            auto start = std::chrono::steady_clock::now();
+            error.clear();
+            try {
+                lexer.resetBuffer(code);
+                lexer.generateStream(stream);
+                parser.reset(&stream);
+                parser.parse();
+            } catch (const std::runtime_error& e) {
+                error = e.what();
+            }
+            int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            best = run == 0 ? ns : std::min(best, ns);
+        }
+        if (!results_path.empty()) {
+            results.push_back(BatchResult{name, error.empty(), best, error});
+            return;
+        }
+        out += error.empty() ? "accept\t" : "reject\t";
+        out += std::to_string(best);
+        out += '\t';
+        out += name;
+        out += '\t';
+        for (char c : error) {
+            out += c == '\t' || c == '\n' || c == '\r' ? ' ' : c;
+        }
+        out += '\n';
+        if (out.size() > (1 << 20) - 4096) {
+            writeOutput(out);
+        }
+    };
+
+    if (!dataset.empty()) {
+        DatasetReader reader(dataset);
+        auto code = std::make_shared<std::string>();
+        while (reader.next(*code)) {
+            std::string name = dataset + ":" + std::to_string(reader.lineNumber());
+            if (shard.owns(name)) {
+                judge(name, code);
+            }
+        }
+    }
+    std::vector<std::string> files;
+    for (const std::string& input : inputs) {
+        collectPythonFiles(input, files);
+    }
+    for (const std::string& file : files) {
+        if (!shard.owns(file)) {
+            continue;
+        }
+        auto code = std::make_shared<std::string>();
+        try {
+            Lexer::readFile(file, *code);
+        } catch (const std::runtime_error& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            continue;
+        }
+        judge(file, code);
+    }
+    if (!results_path.empty()) {
+        writeResults(results_path, shard, std::move(results));
+    } else {
+        writeOutput(out);
+    }
+    return 0;
+}
+
+// Parses the decimal value of a flag, false unless it is in [min, max]
+static bool parseNumber(const std::string& text, unsigned long min, unsigned long max, unsigned long& value) {
+    if (text.empty() || text.size() > 9 || text.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    value = std::stoul(text);
+    return value >= min && value <= max;
+}
+
+// Writes the collected stats as JSON to stderr, or to a file if one was given
+static void dumpStats(const std::string& path) {
+    std::string json = Stats::snapshot().toJson();
+    if (path.empty()) {
+        std::cerr << json;
+        return;
+    }
+    std::ofstream out(path);
+    out << json;
+}
 
 int main(int argc, char** argv) {
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <python_file>" << std::endl;
+    bool stats = false;
+    std::string stats_path;
+    std::vector<std::string> inputs;
+    std::string dataset;
+    std::string build_index;
+    std::string index;
+    std::string subclasses_of;
+    std::string query;
+    bool unimplemented = false;
+    bool compare_parsers = false;
+    bool verdicts = false;
+    Shard shard;
+    bool shard_given = false;
+    std::string results_path;
+    std::string merge_output;
+    bool semantic = false;
+    bool bodies = false;
+    bool project = false;
+    bool deps = false;
+    std::string save_tokens;
+    bool load_tokens = false;
+    bool emit = false;
+    EmitMode emit_mode = EmitMode::Tokens;
+    unsigned jobs = 1;
+    int tab_width = DEFAULT_TAB_WIDTH;
+    ScannerBackend backend = ScannerBackend::HandWritten;
+    FileLoader::Backend io = FileLoader::Backend::Auto;
+    bool jobs_given = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--stats") {
+            stats = true;
+        } else if (arg.rfind("--stats=", 0) == 0) {
+            stats = true;
+            stats_path = arg.substr(8);
+        } else if (arg.rfind("--jobs=", 0) == 0) {
+            // Lex a single large file with N threads (0 = all cores)
+            unsigned long value;
+            if (!parseNumber(arg.substr(7), 0, 1024, value)) {
+                usage(argv[0]);
+                return 1;
+            }
+            jobs = static_cast<unsigned>(value);
+            jobs_given = true;
+        } else if (arg.rfind("--tab-width=", 0) == 0) {
+            unsigned long value;
+            if (!parseNumber(arg.substr(12), 1, 64, value)) {
+                usage(argv[0]);
+                return 1;
+            }
+            tab_width = static_cast<int>(value);
+        } else if (arg == "--scanner=hand" || arg == "--scanner=table") {
+            // Hand-written scanner or the DFA generated from grammar/lexer.l
+            backend = arg == "--scanner=table" ? ScannerBackend::Table : ScannerBackend::HandWritten;
+        } else if (arg == "--io=auto" || arg == "--io=uring" || arg == "--io=threads") {
+            // How many-file modes read their inputs: io_uring if available,
+            // forced, or a pread thread pool
+            io = arg == "--io=uring" ? FileLoader::Backend::IoUring
+                 : arg == "--io=threads" ? FileLoader::Backend::Threads : FileLoader::Backend::Auto;
+        } else if (arg.rfind("--jsonl=", 0) == 0) {
+            dataset = arg.substr(8);
+        } else if (arg.rfind("--build-index=", 0) == 0) {
+            build_index = arg.substr(14);
+        } else if (arg.rfind("--index=", 0) == 0) {
+            index = arg.substr(8);
+        } else if (arg.rfind("--subclasses=", 0) == 0) {
+            subclasses_of = arg.substr(13);
+        } else if (arg.rfind("--query=", 0) == 0) {
+            query = arg.substr(8);
+        } else if (arg.rfind("--save-tokens=", 0) == 0) {
+            save_tokens = arg.substr(14);
+        } else if (arg.rfind("--emit=", 0) == 0) {
+            emit = true;
+            if (!parseEmitMode(arg.substr(7), emit_mode)) {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (arg == "--load-tokens") {
+            // The input is a token file written by --save-tokens
+            load_tokens = true;
+        } else if (arg == "--compare-parsers") {
+            compare_parsers = true;
+        } else if (arg == "--verdicts") {
+            verdicts = true;
+        } else if (arg.rfind("--shard=", 0) == 0) {
+            // With --verdicts, judge only the inputs of shard i of N
+            try {
+                shard = Shard::parse(arg.substr(8));
+            } catch (const std::runtime_error& e) {
+                std::cerr << "Error: " << e.what() << std::endl;
+                return 1;
+            }
+            shard_given = true;
+        } else if (arg.rfind("--results=", 0) == 0) {
+            results_path = arg.substr(10);
+        } else if (arg.rfind("--merge=", 0) == 0) {
+            merge_output = arg.substr(8);
+        } else if (arg == "--check") {
+            semantic = true;
+        } else if (arg == "--bodies") {
+            // Parse method bodies into syntax trees instead of skipping them
+            bodies = true;
+        } else if (arg == "--project") {
+            project = true;
+        } else if (arg == "--deps") {
+            // With --project, print the import graph instead of diagnostics
+            deps = true;
+        } else if (arg == "--unimplemented-abstract") {
+            unimplemented = true;
+        } else if (arg.rfind("--", 0) != 0) {
+            inputs.push_back(arg);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    bool valid;
+    if (!verdicts && (shard_given || !results_path.empty())) {
+        valid = false;
+    } else if (!merge_output.empty()) {
+        valid = !inputs.empty() && dataset.empty() && build_index.empty() && index.empty() && !emit && !bodies &&
+                !project && !verdicts && !compare_parsers && !jobs_given;
+    } else if (compare_parsers) {
+        valid = (!inputs.empty() || !dataset.empty()) && build_index.empty() && index.empty() && !emit &&
+                !bodies && !project && !verdicts && !jobs_given;
+    } else if (verdicts) {
+        valid = (!inputs.empty() || !dataset.empty()) && build_index.empty() && index.empty() && !emit && !project &&
+                !jobs_given;
+    } else if (project) {
+        valid = !inputs.empty() && dataset.empty() && build_index.empty() && index.empty() && !emit && !bodies;
+    } else if (deps) {
+        valid = false;
+    } else if (!build_index.empty()) {
+        valid = !inputs.empty() && dataset.empty() && index.empty() && !emit && !bodies;
+    } else if (emit) {
+        valid = !inputs.empty() && dataset.empty() && index.empty() && !jobs_given;
+    } else if (!index.empty()) {
+        valid = inputs.empty() && dataset.empty() && !subclasses_of.empty() + unimplemented + !query.empty() == 1 &&
+                !bodies && !jobs_given;
+    } else {
+        // --jobs splits the lexing of one file; datasets and saved tokens
+        // have nothing to split
+        valid = inputs.size() + !dataset.empty() == 1 && !(jobs_given && (!dataset.empty() || load_tokens));
+    }
+    if (!valid) {
+        usage(argv[0]);
         return 1;
     }
-    
+
+    int status = 0;
     try {
-        Lexer lexer(argv[1]);
-        TokenStream* stream = lexer.generateStream();
-        RecursiveDescendant parser(stream);
-        parser.parse();
+        if (!merge_output.empty()) {
+            MergeSummary summary = mergeResults(inputs, merge_output);
+            std::cout << "Shards: " << summary.shards << "\n"
+                      << "Inputs: " << summary.inputs << "\n"
+                      << "Accepted: " << summary.accepted << std::endl;
+        } else if (compare_parsers) {
+            status = compareParsers(inputs, dataset, tab_width, backend);
+        } else if (verdicts) {
+            status = printVerdicts(inputs, dataset, tab_width, backend, bodies, shard, results_path);
+        } else if (project) {
+            // Like index builds, projects use every core unless told otherwise
+            status = analyzeProject(inputs, jobs_given ? jobs : 0, io, deps);
+        } else if (!build_index.empty()) {
+            // Index builds use every core unless told otherwise
+            status = buildIndex(build_index, inputs, jobs_given ? jobs : 0, io);
+        } else if (emit) {
+            status = emitFiles(inputs, emit_mode, load_tokens, tab_width, backend, bodies);
+        } else if (!index.empty()) {
+            status = queryIndex(index, subclasses_of, unimplemented, query);
+        } else if (!dataset.empty()) {
+            status = runDataset(dataset, tab_width, backend, bodies);
+        } else if (load_tokens) {
+            TokenStream stream;
+            loadTokens(inputs[0], stream);
+            RecursiveDescendant parser(&stream);
+            parser.setParseBodies(bodies);
+            parser.parse();
+            if (semantic) {
+                status = check(parser);
+            }
+        } else if (jobs != 1) {
+            ParallelLexer lexer(inputs[0], jobs);
+            lexer.setTabWidth(tab_width);
+            lexer.setScanner(backend);
+            std::unique_ptr<TokenStream> stream(lexer.generateStream());
+            if (!save_tokens.empty()) {
+                saveTokens(*stream, save_tokens);
+            }
+            RecursiveDescendant parser(stream.get());
+            parser.setParseBodies(bodies);
+            parser.parse();
+            if (semantic) {
+                status = check(parser);
+            }
+        } else {
+            Lexer lexer(inputs[0]);
+            lexer.setTabWidth(tab_width);
+            lexer.setScanner(backend);
+            std::unique_ptr<TokenStream> stream(lexer.generateStream());
+            if (!save_tokens.empty()) {
+                saveTokens(*stream, save_tokens);
+            }
+            RecursiveDescendant parser(stream.get());
+            parser.setParseBodies(bodies);
+            parser.parse();
+            if (semantic) {
+                status = check(parser);
+            }
+        }
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
-        return 1;
+        status = 1;
     }
-    return 0;
-}
\ No newline at end of file
+
+    if (stats) {
+        dumpStats(stats_path);
+    }
+    return status;
+}
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include "BatchResults.h"
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Fixture para las pruebas de los resultados por shards
+class BatchTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::filesystem::create_directories(root);
+        for (int i = 0; i < 200; i++) {
+            BatchResult result;
+            result.name = "dir/file" + std::to_string(i * 7919 % 200) + ".py";
+            result.accepted = i % 3 != 0;
+            result.ns = 1000 + i;
+            if (!result.accepted) {
+                result.error = "Syntax error in \"line\" " + std::to_string(i) + "\n\tnear here";
+            }
+            results.push_back(result);
+        }
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(root);
+    }
+
+    std::string path(const std::string& name) {
+        return root + "/" + name;
+    }
+
+    std::string readFile(const std::string& name) {
+        std::ifstream file(path(name), std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return buffer.str();
+    }
+
+    // Escribe un archivo de resultados por cada shard de N
+    std::vector<std::string> writeShards(uint32_t count) {
+        std::vector<std::string> paths;
+        for (uint32_t i = 0; i < count; i++) {
+            Shard shard = Shard::parse(std::to_string(i) + "/" + std::to_string(count));
+            std::vector<BatchResult> owned;
+            for (const BatchResult& result : results) {
+                if (shard.owns(result.name)) {
+                    owned.push_back(result);
+                }
+            }
+            paths.push_back(path(std::to_string(i) + ".jsonl"));
+            writeResults(paths.back(), shard, owned);
+        }
+        return paths;
+    }
+
+    std::string root = "temp_batch";
+    std::vector<BatchResult> results;
+};
+
+// Test para verificar el formato i/N de los shards
+TEST_F(BatchTest, ParsesShards) {
+    Shard shard = Shard::parse("2/5");
+    EXPECT_EQ(shard.index, 2u);
+    EXPECT_EQ(shard.count, 5u);
+    EXPECT_EQ(Shard::parse("0/1").count, 1u);
+
+    for (const char* text : {"", "3", "5/5", "1/0", "-1/4", "1/4/8", "a/4", "/4", "1/", "99999999999/1"}) {
+        EXPECT_THROW(Shard::parse(text), std::runtime_error) << text;
+    }
+}
+
+// Test para verificar que cada entrada pertenece a un único shard
+TEST_F(BatchTest, PartitionsInputs) {
+    for (uint32_t count : {1u, 2u, 3u, 8u}) {
+        std::vector<int> per_shard(count, 0);
+        for (const BatchResult& result : results) {
+            int owners = 0;
+            for (uint32_t i = 0; i < count; i++) {
+                Shard shard;
+                shard.index = i;
+                shard.count = count;
+                if (shard.owns(result.name)) {
+                    owners++;
+                    per_shard[i]++;
+                }
+            }
+            EXPECT_EQ(owners, 1) << result.name;
+        }
+        // El hash reparte las entradas entre todos los shards
+        for (int inputs : per_shard) {
+            EXPECT_GT(inputs, 0);
+        }
+    }
+}
+
+// Test para verificar que la mezcla de los shards da lo mismo que una sola ejecución
+TEST_F(BatchTest, MergesShards) {
+    writeResults(path("single.jsonl"), Shard(), results);
+    std::vector<std::string> paths = writeShards(4);
+    // El orden de los archivos no importa
+    std::swap(paths[0], paths[3]);
+
+    MergeSummary summary = mergeResults(paths, path("merged.jsonl"));
+    EXPECT_EQ(summary.shards, 4u);
+    EXPECT_EQ(summary.inputs, results.size());
+    size_t accepted = 0;
+    for (const BatchResult& result : results) {
+        accepted += result.accepted;
+    }
+    EXPECT_EQ(summary.accepted, accepted);
+    EXPECT_EQ(readFile("merged.jsonl"), readFile("single.jsonl"));
+
+    // El resultado mezclado se puede volver a mezclar como un shard 0/1
+    summary = mergeResults({path("merged.jsonl")}, path("again.jsonl"));
+    EXPECT_EQ(summary.inputs, results.size());
+    EXPECT_EQ(readFile("again.jsonl"), readFile("single.jsonl"));
+}
+
+// Test para verificar los errores al mezclar
+TEST_F(BatchTest, RejectsBadMerges) {
+    std::vector<std::string> paths = writeShards(3);
+    std::string output = path("merged.jsonl");
+
+    // Falta un shard
+    EXPECT_THROW(mergeResults({paths[0], paths[2]}, output), std::runtime_error);
+    // Un shard repetido
+    EXPECT_THROW(mergeResults({paths[0], paths[1], paths[1]}, output), std::runtime_error);
+    // Shards de ejecuciones con distinto N
+    std::vector<std::string> other = writeShards(2);
+    EXPECT_THROW(mergeResults({paths[0], paths[1], other[0]}, output), std::runtime_error);
+    // Un archivo que no existe
+    EXPECT_THROW(mergeResults({paths[0], paths[1], path("missing.jsonl")}, output), std::runtime_error);
+
+    // Un archivo truncado
+    std::string text = readFile("2.jsonl");
+    {
+        std::ofstream file(paths[2], std::ios::binary);
+        file << text.substr(0, text.rfind('\n', text.size() - 2) + 1);
+    }
+    EXPECT_THROW(mergeResults(paths, output), std::runtime_error);
+
+    // Una entrada en el shard equivocado
+    Shard shard = Shard::parse("2/3");
+    std::vector<BatchResult> wrong;
+    for (const BatchResult& result : results) {
+        if (!shard.owns(result.name)) {
+            wrong.push_back(result);
+            break;
+        }
+    }
+    writeResults(paths[2], shard, wrong);
+    EXPECT_THROW(mergeResults(paths, output), std::runtime_error);
+}
@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+#include "ClassIndex.h"
+#include "IndexQuery.h"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Fixture para las pruebas del índice de clases
+class ClassIndexTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        for (const std::string& file : files) {
+            std::remove(file.c_str());
+        }
+        std::remove(indexFile.c_str());
+    }
+
+    void writeFile(const std::string& name, const std::string& content) {
+        std::ofstream file(name);
+        file << content;
+        files.push_back(name);
+    }
+
+    std::vector<std::string> files;
+    std::string indexFile = "temp_index.idx";
+};
+
+// Test para verificar subclases y métodos abstractos entre varios archivos
+TEST_F(ClassIndexTest, AnswersHierarchyQueries) {
+    writeFile("temp_base.py",
+        "class Base:\n"
+        "    @abstractmethod\n"
+        "    def area(self):\n"
+        "        pass\n"
+        "\n"
+        "    @abstractmethod\n"
+        "    def name(self):\n"
+        "        pass\n");
+    writeFile("temp_shapes.py",
+        "class Square(Base):\n"
+        "    def area(self):\n"
+        "        return 1\n"
+        "\n"
+        "class Tiny(Square):\n"
+        "    def name(self):\n"
+        "        return 'tiny'\n"
+        "\n"
+        "class Circle(Base, Mixin):\n"
+        "    def area(self):\n"
+        "        return 3\n");
+    writeFile("temp_broken.py", "class Broken(Base)\n    pass\n");
+    writeFile("temp_unlexed.py", "class Unlexed(Base):\n    def f(self):\n        return $\n");
+
+    ClassIndexBuilder builder;
+    // Broken no se parsea, pero su nombre y sus padres sí se indexan;
+    // Unlexed no se tokeniza y no aporta ninguna clase
+    EXPECT_EQ(builder.addFiles(files, 2), 2u);
+    builder.write(indexFile);
+
+    ClassIndex index(indexFile);
+    EXPECT_EQ(index.classCount(), 5u);
+
+    auto base = index.find("Base");
+    ASSERT_EQ(base.second - base.first, 1u);
+    EXPECT_EQ(index.file(base.first), "temp_base.py");
+    EXPECT_EQ(index.methods(base.first), (std::vector<std::string_view>{"area", "name"}));
+    EXPECT_EQ(index.find("Mixin").first, index.find("Mixin").second);
+    EXPECT_EQ(index.find("Unlexed").first, index.find("Unlexed").second);
+
+    std::vector<std::string_view> names;
+    for (uint32_t cls : index.subclasses("Base")) {
+        names.push_back(index.name(cls));
+    }
+    EXPECT_EQ(names, (std::vector<std::string_view>{"Broken", "Circle", "Square", "Tiny"}));
+    EXPECT_TRUE(index.subclasses("Tiny").empty());
+
+    std::vector<std::string> missing;
+    for (const ClassIndex::Unimplemented& u : index.unimplementedAbstract()) {
+        missing.push_back(std::string(index.name(u.cls)) + "." + std::string(u.method) +
+                          " de " + std::string(index.name(u.declared_in)));
+    }
+    EXPECT_EQ(missing, (std::vector<std::string>{
+        "Broken.area de Base", "Broken.name de Base", "Circle.name de Base"}));
+}
+
+// Test para verificar que un método abstracto implementado en una rama
+// hermana, anterior en el MRO a la clase que lo declara, no se reporta
+TEST_F(ClassIndexTest, FollowsC3OrderForAbstractMethods) {
+    writeFile("temp_diamond.py",
+        "class A:\n"
+        "    @abstractmethod\n"
+        "    def f(self):\n"
+        "        pass\n"
+        "\n"
+        "class B(A):\n"
+        "    def f(self):\n"
+        "        pass\n"
+        "\n"
+        "class C(A):\n"
+        "    def g(self):\n"
+        "        pass\n"
+        "\n"
+        "class D(C, B):\n"
+        "    def h(self):\n"
+        "        pass\n"
+        "\n"
+        "class E(C, A):\n"
+        "    def h(self):\n"
+        "        pass\n");
+    ClassIndexBuilder builder;
+    EXPECT_EQ(builder.addFiles(files, 1), 0u);
+    builder.write(indexFile);
+
+    ClassIndex index(indexFile);
+    std::vector<std::string> missing;
+    for (const ClassIndex::Unimplemented& u : index.unimplementedAbstract()) {
+        missing.push_back(std::string(index.name(u.cls)) + "." + std::string(u.method) +
+                          " de " + std::string(index.name(u.declared_in)));
+    }
+    EXPECT_EQ(missing, (std::vector<std::string>{"E.f de A"}));
+}
+
+// Test para verificar las consultas estructurales sobre los índices secundarios
+TEST_F(ClassIndexTest, AnswersStructuralQueries) {
+    writeFile("temp_models.py",
+        "class Model(Base):\n"
+        "    @classmethod\n"
+        "    def create(cls, data: dict[str, Any]) -> \"Model\":\n"
+        "        pass\n"
+        "\n"
+        "    @staticmethod\n"
+        "    def parse(text: str) -> Optional[str]:\n"
+        "        pass\n"
+        "\n"
+        "    def save(self) -> None:\n"
+        "        pass\n");
+    writeFile("temp_users.py",
+        "class User(Model, Mixin):\n"
+        "    @classmethod\n"
+        "    def create(cls) -> User:\n"
+        "        pass\n"
+        "\n"
+        "    @staticmethod\n"
+        "    def label() -> str:\n"
+        "        pass\n"
+        "\n"
+        "class Admin(User):\n"
+        "    def save(self, force: bool) -> None:\n"
+        "        pass\n");
+
+    ClassIndexBuilder builder;
+    EXPECT_EQ(builder.addFiles(files, 2), 0u);
+    builder.write(indexFile);
+    ClassIndex index(indexFile);
+
+    auto names = [&](const std::string& text) {
+        IndexQuery query = IndexQuery::parse(text);
+        std::vector<std::string> found;
+        for (uint32_t id : query.run(index)) {
+            if (query.findsMethods()) {
+                found.push_back(std::string(index.name(index.method(id).cls)) + "." +
+                                std::string(index.methodName(id)));
+            } else {
+                found.push_back(std::string(index.name(id)));
+            }
+        }
+        return found;
+    };
+
+    EXPECT_EQ(names("method=create,first=cls"), (std::vector<std::string>{"Model.create", "User.create"}));
+    EXPECT_EQ(names("decorator=staticmethod,returns=str"), (std::vector<std::string>{"User.label"}));
+    // El tipo de la consulta se normaliza igual que el del código
+    EXPECT_EQ(names("returns=Union[None, str]"), (std::vector<std::string>{"Model.parse"}));
+    EXPECT_EQ(names("returns=Model"), (std::vector<std::string>{"Model.create"}));
+    EXPECT_EQ(names("parent=Model"), (std::vector<std::string>{"User"}));
+    EXPECT_EQ(names("parent=Mixin, method=create"), (std::vector<std::string>{"User.create"}));
+    EXPECT_EQ(names("class=Admin,returns=None"), (std::vector<std::string>{"Admin.save"}));
+    EXPECT_TRUE(names("parent=Base,decorator=@staticmethod,first=cls").empty());
+
+    EXPECT_EQ(index.methodsNamed("save").size(), 2u);
+    EXPECT_EQ(index.methodsDecorated(DECORATOR_CLASSMETHOD).size(), 2u);
+    EXPECT_EQ(index.firstParam(*index.methodsNamed("parse").begin()), "text");
+    EXPECT_EQ(index.returnType(*index.methodsNamed("parse").begin()), "Optional[str]");
+
+    EXPECT_THROW(IndexQuery::parse("name=create"), std::runtime_error);
+    EXPECT_THROW(IndexQuery::parse("decorator=cached"), std::runtime_error);
+    EXPECT_THROW(IndexQuery::parse("returns=dict[str,"), std::runtime_error);
+    EXPECT_THROW(IndexQuery::parse(""), std::runtime_error);
+}
+
+// Test para verificar que se rechaza un archivo que no es un índice
+TEST_F(ClassIndexTest, RejectsInvalidIndex) {
+    writeFile(indexFile, "not an index");
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+}
+
+// Test para verificar que se rechazan índices con offsets o ids fuera de
+// rango, en vez de leer fuera del archivo al consultarlos
+TEST_F(ClassIndexTest, RejectsCorruptIndex) {
+    writeFile("temp_corrupt.py",
+        "class Base:\n"
+        "    def area(self) -> int:\n"
+        "        pass\n"
+        "\n"
+        "class Square(Base):\n"
+        "    @staticmethod\n"
+        "    def make(size):\n"
+        "        pass\n");
+    ClassIndexBuilder builder;
+    builder.addFiles(files, 1);
+    builder.write(indexFile);
+    ASSERT_NO_THROW(ClassIndex index(indexFile));
+
+    std::ifstream in(indexFile, std::ios::binary);
+    const std::string original((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    ClassIndexHeader header;
+    std::memcpy(&header, original.data(), sizeof(header));
+    const size_t classes = sizeof(ClassIndexHeader);
+    const size_t methods = classes + header.class_count * sizeof(IndexedClass) +
+                           (header.file_count + header.parent_count) * sizeof(IndexString);
+    const size_t children = methods + header.method_count * sizeof(IndexedMethod);
+
+    // Escribe el índice con un campo de 32 bits cambiado
+    auto corrupt = [&](size_t offset, uint32_t value) {
+        std::string bytes = original;
+        std::memcpy(&bytes[offset], &value, sizeof(value));
+        std::ofstream(indexFile, std::ios::binary) << bytes;
+    };
+    corrupt(classes + offsetof(IndexedClass, name) + offsetof(IndexString, offset), 0xFFFFFFF0u);
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+    corrupt(classes + offsetof(IndexedClass, name) + offsetof(IndexString, length), header.string_bytes + 1);
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+    corrupt(classes + offsetof(IndexedClass, file), header.file_count);
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+    corrupt(classes + offsetof(IndexedClass, first_method), header.method_count);
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+    corrupt(methods + offsetof(IndexedMethod, cls), header.class_count);
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+    corrupt(methods + offsetof(IndexedMethod, return_type) + offsetof(IndexString, offset), header.string_bytes);
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+    corrupt(children, header.class_count);
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+    corrupt(offsetof(ClassIndexHeader, decorated_first), header.decorated_first[4] + 1);
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+
+    // Truncado y rellenado hasta el tamaño original
+    std::string padded = original.substr(0, original.size() / 2);
+    padded.resize(original.size(), '\xff');
+    std::ofstream(indexFile, std::ios::binary) << padded;
+    EXPECT_THROW(ClassIndex index(indexFile), std::runtime_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,8 +1,23 @@
 #include <gtest/gtest.h>
+#include "Dataset.h"
+#include "Emitter.h"
+#include "FileLoader.h"
 #include "Lexer.h"
+#include "Num.h"
+#include "ParallelLexer.h"
+#include "Str.h"
+#include "Stats.h"
+#include "SymbolTable.h"
+#include "TokenSerializer.h"
+#include "Word.h"
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 #include <memory>
+#include <memory_resource>
+#include <random>
+#include <thread>
+#include <zlib.h>
 
 // Fixture para las pruebas del Lexer
 class LexerTest : public ::testing::Test {
@@ -45,7 +60,7 @@ TEST_F(LexerTest, ThrowsOnNonExistentFile) {
 TEST_F(LexerTest, RecognizesKeywords) {
     writeToTempFile("@property def class if else");
     Lexer lexer(tempFile);
-    auto stream = lexer.generateStream();
+    std::unique_ptr<TokenStream> stream(lexer.generateStream());
     
     EXPECT_EQ(stream->next()->tag, static_cast<int>(Tag::PROPERTY));
     EXPECT_EQ(stream->next()->tag, static_cast<int>(Tag::DEF));
@@ -59,7 +74,7 @@ TEST_F(LexerTest, RecognizesKeywords) {
 TEST_F(LexerTest, RecognizesIdentifiers) {
     writeToTempFile("myVariable _private_var");
     Lexer lexer(tempFile);
-    auto stream = lexer.generateStream();
+    std::unique_ptr<TokenStream> stream(lexer.generateStream());
     
     Token* token = stream->next();
     EXPECT_EQ(token->tag, static_cast<int>(Tag::VARIABLE));
@@ -70,23 +85,366 @@ TEST_F(LexerTest, RecognizesIdentifiers) {
     EXPECT_EQ(dynamic_cast<Word*>(token)->lexeme, "_private_var");
 }
 
+// Test para verificar identificadores UTF-8 (PEP 3131)
+TEST_F(LexerTest, RecognizesUnicodeIdentifiers) {
+    Lexer lexer;
+    TokenStream stream;
+
+    // BOM, letras acentuadas, griego, CJK y una marca combinante (U+0301)
+    lexer.resetText("\xEF\xBB\xBF" "año = \"ñ\" + π\n変数 e\xCC\x81t\n");
+    lexer.generateStream(stream);
+    ASSERT_EQ(stream.size(), 9u);
+    EXPECT_EQ(dynamic_cast<Word*>(stream.at(0))->lexeme, "año");
+    EXPECT_EQ(stream.at(2)->tag, static_cast<int>(Tag::STRING));
+    EXPECT_EQ(dynamic_cast<Word*>(stream.at(4))->lexeme, "π");
+    EXPECT_EQ(dynamic_cast<Word*>(stream.at(6))->lexeme, "変数");
+    EXPECT_EQ(dynamic_cast<Word*>(stream.at(7))->lexeme, "e\xCC\x81t");
+
+    // Las columnas cuentan caracteres, no bytes
+    lexer.resetText("año x");
+    lexer.generateStream(stream);
+    EXPECT_EQ(lexer.get_column(), 5);
+
+    // Un símbolo, una marca al inicio o UTF-8 inválido no son identificadores
+    lexer.resetText("a = €\n");
+    EXPECT_THROW(lexer.generateStream(stream), std::runtime_error);
+    lexer.resetText("\xCC\x81" "a\n");
+    EXPECT_THROW(lexer.generateStream(stream), std::runtime_error);
+    lexer.resetText("a\xC3\n");
+    EXPECT_THROW(lexer.generateStream(stream), std::runtime_error);
+    lexer.resetText("1é\n");
+    EXPECT_THROW(lexer.generateStream(stream), std::runtime_error);
+}
+
 // Test para verificar el reconocimiento de números
 TEST_F(LexerTest, RecognizesNumbers) {
     writeToTempFile("123 45.67");
     Lexer lexer(tempFile);
-    auto stream = lexer.generateStream();
+    std::unique_ptr<TokenStream> stream(lexer.generateStream());
     
     Token* token = stream->next();
     EXPECT_EQ(token->tag, static_cast<int>(Tag::NUM));
     EXPECT_EQ(dynamic_cast<Num*>(token)->value, 123);
-        
+
+    token = stream->next();
+    EXPECT_EQ(token->tag, static_cast<int>(Tag::NUM));
+    EXPECT_EQ(dynamic_cast<Num*>(token)->kind, Num::Kind::Float);
+    EXPECT_DOUBLE_EQ(dynamic_cast<Num*>(token)->real, 45.67);
+}
+
+// Test para verificar literales numéricos con base, exponente y separadores
+TEST_F(LexerTest, RecognizesNumericLiterals) {
+    writeToTempFile("0x1F 0o17 0b101 1_000_000 .5 1e3 2.5E-2 3j 99999999999999999999");
+    Lexer lexer(tempFile);
+    std::unique_ptr<TokenStream> stream(lexer.generateStream());
+
+    EXPECT_EQ(dynamic_cast<Num*>(stream->next())->value, 31);
+    EXPECT_EQ(dynamic_cast<Num*>(stream->next())->value, 15);
+    EXPECT_EQ(dynamic_cast<Num*>(stream->next())->value, 5);
+    EXPECT_EQ(dynamic_cast<Num*>(stream->next())->value, 1000000);
+    EXPECT_DOUBLE_EQ(dynamic_cast<Num*>(stream->next())->real, 0.5);
+    EXPECT_DOUBLE_EQ(dynamic_cast<Num*>(stream->next())->real, 1000.0);
+    EXPECT_DOUBLE_EQ(dynamic_cast<Num*>(stream->next())->real, 0.025);
+
+    Num* imaginary = dynamic_cast<Num*>(stream->next());
+    EXPECT_EQ(imaginary->kind, Num::Kind::Imaginary);
+    EXPECT_DOUBLE_EQ(imaginary->real, 3.0);
+
+    Num* big = dynamic_cast<Num*>(stream->next());
+    EXPECT_EQ(big->kind, Num::Kind::Int);
+    EXPECT_TRUE(big->big);
+    EXPECT_DOUBLE_EQ(big->real, 1e20);
+    EXPECT_EQ(stream->next(), nullptr);
+}
+
+// Test para verificar que se rechazan literales mal formados
+TEST_F(LexerTest, RejectsMalformedNumbers) {
+    for (const char* code : {"1__0", "1_", "0x", "0b2", "12abc"}) {
+        writeToTempFile(code);
+        Lexer lexer(tempFile);
+        EXPECT_THROW(lexer.generateStream(), std::runtime_error) << code;
+    }
+}
+
+// Test para verificar cadenas y docstrings
+TEST_F(LexerTest, RecognizesStrings) {
+    writeToTempFile("'a\\tb' \"\" \"\"\"doc\nstring \"quoted\" \"\"\" x");
+    Lexer lexer(tempFile);
+    std::unique_ptr<TokenStream> stream(lexer.generateStream());
+
+    Str* str = dynamic_cast<Str*>(stream->next());
+    ASSERT_NE(str, nullptr);
+    EXPECT_EQ(str->tag, static_cast<int>(Tag::STRING));
+    EXPECT_EQ(str->raw, "a\\tb");
+    EXPECT_EQ(str->value(), "a\tb");
+
+    str = dynamic_cast<Str*>(stream->next());
+    ASSERT_NE(str, nullptr);
+    EXPECT_EQ(str->value(), "");
+
+    str = dynamic_cast<Str*>(stream->next());
+    ASSERT_NE(str, nullptr);
+    EXPECT_EQ(str->tag, static_cast<int>(Tag::DOCSTRING));
+    EXPECT_EQ(str->value(), "doc\nstring \"quoted\" ");
+
+    EXPECT_EQ(stream->next()->tag, static_cast<int>(Tag::VARIABLE));
+    EXPECT_EQ(lexer.get_line(), 2);
+}
+
+// Test para verificar las secuencias de escape, incluidas las desconocidas,
+// que como en Python conservan la barra
+TEST_F(LexerTest, ProcessesEscapes) {
+    auto value = [](std::string_view raw) { return Str(raw, static_cast<int>(Tag::STRING)).value(); };
+    EXPECT_EQ(value("\\d+\\.\\q"), "\\d+\\.\\q");
+    EXPECT_EQ(value("\\d"), "\\d");
+    EXPECT_EQ(value("a\\\\b"), "a\\b");
+    EXPECT_EQ(value("\\a\\b\\f\\v\\'\\\""), "\a\b\f\v'\"");
+    EXPECT_EQ(value("line\\\ncontinued"), "linecontinued");
+    EXPECT_EQ(value("\\x41\\101\\0\\u00e9\\U0001F600"), std::string("AA") + '\0' + "\xC3\xA9\xF0\x9F\x98\x80");
+    // Escapes incompletos o con nombre se quedan como están
+    EXPECT_EQ(value("\\x4"), "\\x4");
+    EXPECT_EQ(value("\\N{DASH}"), "\\N{DASH}");
+    EXPECT_EQ(value("end\\"), "end\\");
+}
+
+// Test para verificar que las cadenas sin cerrar son un error
+TEST_F(LexerTest, RejectsUnterminatedStrings) {
+    for (const char* code : {"'abc", "'abc\n'", "\"\"\"abc\"\""}) {
+        writeToTempFile(code);
+        Lexer lexer(tempFile);
+        EXPECT_THROW(lexer.generateStream(), std::runtime_error) << code;
+    }
+}
+
+// Test para verificar que un Lexer y un TokenStream se pueden reutilizar
+TEST_F(LexerTest, ResetReusesLexerAndStream) {
+    Lexer lexer;
+    TokenStream stream;
+
+    lexer.resetText("class A:\n    x = 'a'\n");
+    lexer.generateStream(stream);
+    size_t first_size = stream.size();
+    Token* first_class = stream.at(0);
+    EXPECT_EQ(first_size, 10u);
+
+    lexer.resetText("if y:\n    pass");
+    lexer.generateStream(stream);
+    EXPECT_EQ(stream.size(), 7u);
+    EXPECT_EQ(stream.next()->tag, static_cast<int>(Tag::IF));
+    EXPECT_EQ(lexer.get_line(), 2);
+
+    // Shared tokens (keywords, identifiers) are the same objects every time
+    writeToTempFile("class A:\n    x = 'a'\n");
+    lexer.reset(tempFile);
+    lexer.generateStream(stream);
+    EXPECT_EQ(stream.size(), first_size);
+    EXPECT_EQ(stream.at(0), first_class);
+    EXPECT_EQ(dynamic_cast<Str*>(stream.at(7))->value(), "a");
+}
+
+// Test para verificar que los tokens siguen válidos al destruir el lexer
+TEST_F(LexerTest, StreamOutlivesLexer) {
+    TokenStream stream;
+    std::weak_ptr<SymbolTable> symbols;
+    {
+        Lexer lexer;
+        lexer.resetText("class Shape:\n    area = 'x'\n");
+        lexer.generateStream(stream);
+        symbols = lexer.symbolTable();
+    }
+    // La tabla de símbolos vive mientras la use el stream
+    EXPECT_FALSE(symbols.expired());
+    EXPECT_EQ(stream.at(0)->tag, static_cast<int>(Tag::CLASS));
+    EXPECT_EQ(dynamic_cast<Word*>(stream.at(1))->lexeme, "Shape");
+    EXPECT_EQ(dynamic_cast<Str*>(stream.at(7))->value(), "x");
+
+    stream.clear();
+    EXPECT_TRUE(symbols.expired());
+
+    // Dos lexers que comparten la tabla comparten sus Words
+    auto shared = SymbolTable::create();
+    Lexer first(shared);
+    Lexer second(shared);
+    TokenStream other;
+    first.resetText("foo = bar\n");
+    first.generateStream(stream);
+    second.resetText("bar = foo\n");
+    second.generateStream(other);
+    EXPECT_EQ(stream.at(0), other.at(2));
+    EXPECT_EQ(stream.at(2), other.at(0));
+    EXPECT_EQ(shared->find("foo"), stream.at(0));
+}
+
+// Test para verificar que los puntos de corte ignoran docstrings y comentarios
+TEST_F(LexerTest, FindsSplitPointsOutsideStrings) {
+    std::string code =
+        "import os\n"
+        "class A:\n"
+        "    '''\n"
+        "class NotASplit:\n"
+        "'''\n"
+        "# 'def not_a_split\n"
+        "@staticmethod\n"
+        "def f(x):\n"
+        "    pass\n";
+    std::vector<SplitPoint> points = findSplitPoints(code);
+    ASSERT_EQ(points.size(), 3u);
+    EXPECT_EQ(points[0].line, 2);
+    EXPECT_EQ(points[1].line, 7);
+    EXPECT_EQ(points[2].line, 8);
+    EXPECT_EQ(code.substr(points[0].offset, 5), "class");
+}
+
+// Test para verificar que el lexer paralelo produce los mismos tokens
+TEST_F(LexerTest, ParallelLexingMatchesSequential) {
+    std::string code;
+    for (int i = 0; code.size() < 4 * ParallelLexer::MIN_CHUNK_BYTES; i++) {
+        code += "class C" + std::to_string(i) + "(Base):\n"
+                "    \"\"\"Docstring\n"
+                "def inside_docstring(self):\n"
+                "    \"\"\"\n"
+                "    @property\n"
+                "    def value(self) -> int:\n"
+                "        if self.x >= 0x1F:\n"
+                "            return 'a' + \"b\"  # comment\n"
+                "        return 1.5\n"
+                "\n"
+                "# trailing comment\n";
+    }
+    writeToTempFile(code);
+
+    Lexer sequential(tempFile);
+    std::unique_ptr<TokenStream> expected(sequential.generateStream());
+    ParallelLexer parallel(tempFile, 4);
+    std::unique_ptr<TokenStream> actual(parallel.generateStream());
+
+    EXPECT_GT(parallel.chunkCount(), 1u);
+    ASSERT_EQ(actual->size(), expected->size());
+    for (size_t i = 0; i < expected->size(); i++) {
+        ASSERT_EQ(actual->at(i)->tag, expected->at(i)->tag) << "token " << i;
+        ASSERT_EQ(actual->at(i)->toString(), expected->at(i)->toString()) << "token " << i;
+    }
+}
+
+// Test para verificar que un stream serializado se carga igual
+TEST_F(LexerTest, SerializedStreamRoundTrips) {
+    std::string code =
+        "class A(B):\n"
+        "    def f(self, x: int = -3) -> str:\n"
+        "        '''doc'''\n"
+        "        if x >= 0x7FFFFFFFFFFF and y != 2.5e3:\n"
+        "            return 'a\\n' + \"b\" * 3j, 99999999999999999999\n"
+        "        return x\n";
+    writeToTempFile(code);
+    Lexer lexer(tempFile);
+    std::unique_ptr<TokenStream> expected(lexer.generateStream());
+
+    std::string tokenFile = "temp_test.tok";
+    saveTokens(*expected, tokenFile);
+    TokenStream actual;
+    loadTokens(tokenFile, actual);
+    std::remove(tokenFile.c_str());
+
+    ASSERT_EQ(actual.size(), expected->size());
+    for (size_t i = 0; i < expected->size(); i++) {
+        ASSERT_EQ(actual.at(i)->tag, expected->at(i)->tag) << "token " << i;
+        ASSERT_EQ(actual.at(i)->toString(), expected->at(i)->toString()) << "token " << i;
+    }
+    // Las palabras repetidas comparten un único token
+    std::vector<Token*> xs;
+    for (size_t i = 0; i < actual.size(); i++) {
+        Word* word = dynamic_cast<Word*>(actual.at(i));
+        if (word && word->lexeme == "x") {
+            xs.push_back(word);
+        }
+    }
+    ASSERT_EQ(xs.size(), 3u);
+    EXPECT_EQ(xs[0], xs[1]);
+    EXPECT_EQ(xs[0], xs[2]);
+
+    std::string corrupt = "OOPT";
+    EXPECT_THROW(deserializeTokens(nullptr, corrupt, actual), std::runtime_error);
+}
+
+// Recurso de memoria que cuenta lo que reserva y libera
+class CountingResource : public std::pmr::memory_resource {
+public:
+    size_t allocations = 0;
+    size_t live_bytes = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocations++;
+        live_bytes += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        live_bytes -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// Test para verificar que el lexer y el stream usan el recurso de memoria dado
+TEST_F(LexerTest, UsesGivenMemoryResource) {
+    std::string code = "class A:\n    def f(self, x=1.5):\n        return 'a' + x\n";
+    CountingResource counting;
+    {
+        Lexer lexer(&counting);
+        TokenStream stream(&counting);
+        lexer.resetText(code);
+        lexer.generateStream(stream);
+        EXPECT_EQ(stream.size(), 24u);
+        EXPECT_GT(counting.allocations, 0u);
+    }
+    // Todo lo reservado se devolvió al recurso
+    EXPECT_EQ(counting.live_bytes, 0u);
+
+    // Un stream en una arena sin recurso de respaldo: cualquier reserva
+    // fuera de la arena lanzaría bad_alloc
+    alignas(std::max_align_t) char buffer[16 * 1024];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    Lexer lexer;
+    TokenStream stream(&arena);
+    lexer.resetText(code);
+    ASSERT_NO_THROW(lexer.generateStream(stream));
+    EXPECT_EQ(stream.resource(), &arena);
+    EXPECT_EQ(dynamic_cast<Num*>(stream.at(12))->real, 1.5);
+}
+
+// Test para verificar que las Words y sus lexemas, también los que no caben
+// en un std::string sin reservar, viven en el recurso de la tabla
+TEST_F(LexerTest, KeepsLexemesInTableResource) {
+    alignas(std::max_align_t) static char buffer[64 * 1024];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    auto inside = [&](const void* p) {
+        return static_cast<const char*>(p) >= buffer && static_cast<const char*>(p) < buffer + sizeof(buffer);
+    };
+    auto symbols = SymbolTable::create(&arena);
+    std::string name(100, 'x');
+    Word* word = symbols->intern(name, static_cast<int>(Tag::VARIABLE));
+    EXPECT_EQ(word->lexeme, name);
+    EXPECT_EQ(symbols->intern(name, static_cast<int>(Tag::VARIABLE)), word);
+    EXPECT_TRUE(inside(word));
+    EXPECT_TRUE(inside(word->lexeme.data()));
+
+    Lexer lexer(symbols);
+    TokenStream stream;
+    lexer.resetText("a_rather_long_identifier_for_the_small_string_buffer = 1\n");
+    lexer.generateStream(stream);
+    Word* lexed = dynamic_cast<Word*>(stream.at(0));
+    ASSERT_NE(lexed, nullptr);
+    EXPECT_EQ(lexed->lexeme, "a_rather_long_identifier_for_the_small_string_buffer");
+    EXPECT_TRUE(inside(lexed->lexeme.data()));
 }
 
 // Test para verificar el manejo de indentación
 TEST_F(LexerTest, HandlesIndentation) {
     writeToTempFile("def test():\n    x = 1\n    y = 2");
     Lexer lexer(tempFile);
-    auto stream = lexer.generateStream();
+    std::unique_ptr<TokenStream> stream(lexer.generateStream());
     
     EXPECT_EQ(stream->next()->tag, static_cast<int>(Tag::DEF));
     EXPECT_EQ(stream->next()->tag, static_cast<int>(Tag::VARIABLE));
@@ -106,7 +464,310 @@ TEST_F(LexerTest, HandlesIndentation) {
         
 }
 
+// Test para verificar varios DEDENT seguidos y los operadores de dos caracteres
+TEST_F(LexerTest, HandlesNestedDedents) {
+    Lexer lexer;
+    TokenStream stream;
+    lexer.resetText("if a==b:\n  if c:\n    if d>=e:\n      pass\nf\n");
+    lexer.generateStream(stream);
+
+    std::string tags;
+    for (size_t i = 0; i < stream.size(); i++) {
+        tags += std::string(tagName(stream.at(i)->tag)) + " ";
+    }
+    EXPECT_EQ(tags,
+        "IF VARIABLE LOGIC_OP VARIABLE COLON NEWLINE "
+        "INDENT IF VARIABLE COLON NEWLINE "
+        "INDENT IF VARIABLE LOGIC_OP VARIABLE COLON NEWLINE "
+        "INDENT PASS NEWLINE "
+        "DEDENT DEDENT DEDENT VARIABLE NEWLINE ");
+    EXPECT_EQ(lexer.get_line(), 6);
+}
+
+// Test para verificar el ancho de tabulación y la mezcla de tabs y espacios
+TEST_F(LexerTest, HandlesTabs) {
+    Lexer lexer;
+    TokenStream stream;
+    std::string code = "if a:\n\tb\n        c\n";
+
+    // Con tabs de 8 columnas el tab y los ocho espacios miden lo mismo,
+    // pero Python lo rechaza porque depende del ancho del tab
+    lexer.resetText(code);
+    EXPECT_THROW(lexer.generateStream(stream), std::runtime_error);
+
+    lexer.setTabCheck(false);
+    lexer.resetText(code);
+    lexer.generateStream(stream);
+    EXPECT_EQ(stream.size(), 10u);
+
+    // Con tabs de 4, "c" abre otro bloque
+    lexer.setTabWidth(4);
+    lexer.resetText(code);
+    lexer.generateStream(stream);
+    EXPECT_EQ(stream.at(7)->tag, static_cast<int>(Tag::INDENT));
+
+    // Un tab avanza hasta el siguiente múltiplo del ancho: "  \t" mide 4
+    lexer.setTabCheck(true);
+    lexer.resetText("if a:\n  \tb\n  \tc\n");
+    lexer.generateStream(stream);
+    EXPECT_EQ(stream.size(), 10u);
+
+    EXPECT_THROW(lexer.setTabWidth(0), std::runtime_error);
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
-} 
\ No newline at end of file
+} 
+// Tokens (en el formato de --emit=tokens) y posición final de un lexer, o
+// "error" si lanza una excepción
+static std::string lexWith(ScannerBackend backend, const std::string& code) {
+    Lexer lexer;
+    lexer.setScanner(backend);
+    lexer.resetText(code);
+    TokenStream stream;
+    try {
+        lexer.generateStream(stream);
+    } catch (const std::runtime_error&) {
+        return "error";
+    }
+    std::string out;
+    emitTokens(stream, out);
+    return out + "@" + std::to_string(lexer.get_line()) + ":" + std::to_string(lexer.get_column());
+}
+
+// Test para verificar que el escáner generado desde grammar/lexer.l da los
+// mismos tokens y errores que el escrito a mano
+TEST_F(LexerTest, TableScannerMatchesHandWritten) {
+    const char* cases[] = {
+        "class A(B):\n    @property\n    def f(self) -> int:\n        return self.x >= 1\n",
+        "@staticmethod\n@custom_1 @ x\ndef __init__(cls, *a, **k): pass\n",
+        "x = 0x_ff + 0o17 - 0b1 * 1_000 / 3.5e-2 % .5j\n1. 1.e5 1e5j 00 1..2\n",
+        "if a==b!=c<d<=e>f>=g: x=-1->y\n",
+        "'a\\'b' \"c\\\"d\" '' \"\" 'x\\\ny'\n",
+        "\"\"\"doc\n\"quoted\" \"\"\" '''single ''quoted'' '''\n\"\"\"\"\"\"\n",
+        "# comentario\n  \n\tx = 1  # fin\r\n",
+        "def f():\n    if x:\n        pass\n\n  # raro\n    y\nz\n",
+        "héllo = ñandú + café\nif_é = 1\n@décor\n",
+        "\xEF\xBB\xBFx = 1\n",
+        // Errores
+        "1__0", "1_", "0x", "0b2", "12abc", "1é", "'abc", "'abc\n'", "\"\"\"abc\"\"",
+        "'''abc''", "\"\"\"a\\", "x = !a", "a $ b", "a ; b", "x = \xE2\x82\xAC",
+        "\xFF", "def f():\n        x\n    y\n",
+    };
+    for (const char* code : cases) {
+        EXPECT_EQ(lexWith(ScannerBackend::Table, code), lexWith(ScannerBackend::HandWritten, code)) << code;
+    }
+}
+
+// Test para comparar ambos escáneres sobre entradas aleatorias
+TEST_F(LexerTest, TableScannerMatchesOnRandomInput) {
+    const char* pieces[] = {
+        "class", "def", "self", "cls", "__init__", "if", "in", "int", "is", "not", "x", "_y2",
+        "@property", "@abc", "@", "0", "7", "0x1f", "0b", "1_0", "_", ".", "5", "e", "j", "+", "-",
+        "=", "!", "<", ">", "(", ")", ":", ",", "'", "\"", "\"\"\"", "'''", "\\", "#", " ", "  ",
+        "\t", "\n", "\n    ", "\n        ", "\r\n", "é", "\xE2\x82\xAC", "$",
+    };
+    std::mt19937 random(42);
+    std::uniform_int_distribution<size_t> piece(0, sizeof(pieces) / sizeof(pieces[0]) - 1);
+    std::uniform_int_distribution<int> count(1, 16);
+    for (int i = 0; i < 5000; i++) {
+        std::string code;
+        for (int n = count(random); n > 0; n--) {
+            code += pieces[piece(random)];
+        }
+        ASSERT_EQ(lexWith(ScannerBackend::Table, code), lexWith(ScannerBackend::HandWritten, code)) << code;
+    }
+}
+
+// Test para verificar que los bytes 0xFE y 0xFF no terminan la entrada:
+// ningún carácter UTF-8 empieza por ellos
+TEST_F(LexerTest, RejectsBytesThatCannotStartUtf8) {
+    auto errorOf = [](ScannerBackend backend, const std::string& code) {
+        Lexer lexer;
+        lexer.setScanner(backend);
+        lexer.resetText(code);
+        TokenStream stream;
+        try {
+            lexer.generateStream(stream);
+        } catch (const std::runtime_error& e) {
+            return std::string(e.what());
+        }
+        return std::string();
+    };
+    const std::string cases[] = {
+        "class A:\n    def f(self):\n        pass\n\xff ))) junk",
+        "x = 1 \xfe\n",
+        "\xff",
+    };
+    for (const std::string& code : cases) {
+        for (ScannerBackend backend : {ScannerBackend::HandWritten, ScannerBackend::Table}) {
+            EXPECT_EQ(errorOf(backend, code).rfind("Invalid UTF-8 at line ", 0), 0u) << code;
+        }
+    }
+    // Dentro de un comentario se siguen ignorando, como cualquier otro byte
+    EXPECT_EQ(errorOf(ScannerBackend::HandWritten, "# \xff\nx\n"), "");
+
+    // Lo mismo al escanear por trozos en paralelo, con el byte en el último
+    std::string code;
+    while (code.size() < 4 * ParallelLexer::MIN_CHUNK_BYTES) {
+        code += "class A:\n    def f(self):\n        pass\n";
+    }
+    writeToTempFile(code + "\xff ))) junk");
+    ParallelLexer parallel(tempFile, 4);
+    EXPECT_THROW(parallel.generateStream(), std::runtime_error);
+    EXPECT_GT(parallel.chunkCount(), 1u);
+}
+
+// Test para verificar la carga de muchos archivos con cada backend
+TEST_F(LexerTest, LoadsFilesAhead) {
+    // Más archivos que la profundidad, uno vacío, uno grande y uno que no existe
+    std::vector<std::string> paths;
+    std::vector<std::string> contents;
+    for (int i = 0; i < 40; i++) {
+        std::string code;
+        if (i == 7) {
+            for (int line = 0; line < 20000; line++) {
+                code += "x" + std::to_string(line) + " = 'value'\n";
+            }
+        } else if (i != 3) {
+            code = "class C" + std::to_string(i) + ":\n    pass\n";
+        }
+        paths.push_back("temp_load_" + std::to_string(i) + ".py");
+        contents.push_back(code);
+        std::ofstream(paths.back(), std::ios::binary) << code;
+    }
+    paths.push_back("temp_load_missing.py");
+
+    std::vector<FileLoader::Backend> backends = {FileLoader::Backend::Threads};
+    if (FileLoader::ioUringAvailable()) {
+        backends.push_back(FileLoader::Backend::IoUring);
+    }
+    for (FileLoader::Backend backend : backends) {
+        FileLoader loader(paths, backend, 8);
+        EXPECT_EQ(loader.backend(), backend);
+        std::vector<bool> seen(paths.size(), false);
+        FileLoader::File file;
+        Lexer lexer;
+        TokenStream stream;
+        while (loader.next(file)) {
+            ASSERT_LT(file.index, paths.size());
+            EXPECT_FALSE(seen[file.index]);
+            seen[file.index] = true;
+            if (file.index == contents.size()) {
+                EXPECT_EQ(file.error, "Cannot open source file: temp_load_missing.py");
+                continue;
+            }
+            EXPECT_TRUE(file.error.empty()) << file.error;
+            EXPECT_EQ(*file.contents, contents[file.index]) << file.index;
+            // El buffer se escanea sin copiarlo
+            lexer.resetBuffer(std::move(file.contents));
+            lexer.generateStream(stream);
+            std::string tokens;
+            emitTokens(stream, tokens);
+            tokens += "@" + std::to_string(lexer.get_line()) + ":" + std::to_string(lexer.get_column());
+            EXPECT_EQ(tokens, lexWith(ScannerBackend::HandWritten, contents[file.index]));
+        }
+        EXPECT_EQ(std::count(seen.begin(), seen.end(), true), static_cast<long>(paths.size()));
+    }
+
+    // Un loader destruido antes de entregar todo no se bloquea
+    { FileLoader loader(paths, FileLoader::Backend::Auto, 4); }
+    for (size_t i = 0; i < contents.size(); i++) {
+        std::remove(paths[i].c_str());
+    }
+}
+
+// Test para verificar la lectura de datasets JSONL comprimidos con gzip
+TEST_F(LexerTest, ReadsGzipDatasets) {
+    // Un registro más largo que la ventana inicial, uno sin el campo y la
+    // última línea sin salto de línea
+    std::string big(300 * 1024, 'x');
+    std::vector<std::string> records = {
+        "{\"correct_code\": \"class A:\\n    pass\\n\"}",
+        "{\"other\": 1}",
+        "{\"id\": 2, \"correct_code\": \"" + big + "\"}",
+        "{\"correct_code\": \"x = '\\u00e9'\"}",
+    };
+    std::string text;
+    for (const std::string& record : records) {
+        text += record + "\n";
+    }
+    text.pop_back();
+    std::vector<std::string> expected = {"class A:\n    pass\n", big, "x = '\xC3\xA9'"};
+
+    std::ofstream("temp_dataset.jsonl", std::ios::binary) << text;
+    // Dos miembros gzip seguidos, como al concatenar archivos con cat
+    size_t half = text.size() / 2;
+    for (int member = 0; member < 2; member++) {
+        gzFile gz = gzopen("temp_dataset.jsonl.gz", member == 0 ? "wb" : "ab");
+        std::string part = member == 0 ? text.substr(0, half) : text.substr(half);
+        gzwrite(gz, part.data(), static_cast<unsigned>(part.size()));
+        gzclose(gz);
+    }
+
+    for (const char* path : {"temp_dataset.jsonl", "temp_dataset.jsonl.gz"}) {
+        DatasetReader reader(path);
+        std::vector<std::string> snippets;
+        std::string code;
+        while (reader.next(code)) {
+            snippets.push_back(code);
+        }
+        EXPECT_EQ(snippets, expected) << path;
+        EXPECT_EQ(reader.lineNumber(), 4u) << path;
+    }
+
+    // Un archivo gzip truncado es un error
+    std::ifstream whole("temp_dataset.jsonl.gz", std::ios::binary);
+    std::string compressed((std::istreambuf_iterator<char>(whole)), std::istreambuf_iterator<char>());
+    std::ofstream("temp_dataset.jsonl.gz", std::ios::binary) << compressed.substr(0, compressed.size() - 20);
+    DatasetReader truncated("temp_dataset.jsonl.gz");
+    std::string code;
+    EXPECT_THROW(while (truncated.next(code)) {}, std::runtime_error);
+    std::remove("temp_dataset.jsonl");
+    std::remove("temp_dataset.jsonl.gz");
+}
+
+// Test para verificar la salida de --stats, sumando los contadores de
+// hilos que siguen contando mientras se leen
+TEST_F(LexerTest, SnapshotsStatsOfRunningThreads) {
+    Stats::resetAll();
+    std::atomic<bool> started(false);
+    std::atomic<bool> stop(false);
+    std::thread worker([&] {
+        ThreadStats& stats = Stats::local();
+        stats.files_read += 1;
+        started = true;
+        while (!stop) {
+            stats.bytes_read += 10;
+            ++stats.tokens_by_tag[static_cast<int>(Tag::DEF)];
+        }
+    });
+    while (!started) {
+        std::this_thread::yield();
+    }
+    // Lecturas concurrentes con el hilo que cuenta
+    uint64_t last = 0;
+    for (int i = 0; i < 100; i++) {
+        Stats snapshot = Stats::snapshot();
+        EXPECT_GE(snapshot.bytes_read, last);
+        EXPECT_EQ(snapshot.files_read, 1u);
+        last = snapshot.bytes_read;
+    }
+    stop = true;
+    worker.join();
+
+    // El hilo ya terminó: sus contadores pasan a los de hilos retirados
+    Stats::local().files_read += 2;
+    Stats total = Stats::snapshot();
+    EXPECT_EQ(total.files_read, 3u);
+    EXPECT_EQ(total.bytes_read, 10 * total.tokens_by_tag[static_cast<int>(Tag::DEF)]);
+    std::string json = total.toJson();
+    EXPECT_NE(json.find("\"files_read\": 3,"), std::string::npos) << json;
+    EXPECT_NE(json.find("\"bytes_read\": " + std::to_string(total.bytes_read) + ","), std::string::npos);
+    EXPECT_NE(json.find("\"tokens_total\": " + std::to_string(total.tokens_by_tag[static_cast<int>(Tag::DEF)])),
+              std::string::npos);
+
+    Stats::resetAll();
+    EXPECT_EQ(Stats::snapshot().files_read, 0u);
+}
@@ -2,9 +2,13 @@
 #include "Parser.h"
 #include "Lexer.h"
 #include "RecursiveDescendant.h"
+#include "LalrParser.h"
+#include "LL1Parser.h"
+#include "Emitter.h"
 #include <fstream>
 #include <sstream>
 #include <memory>
+#include <random>
 
 // Fixture para las pruebas del Parser
 class ParserTest : public ::testing::Test {
@@ -23,15 +27,17 @@ protected:
         file.close();
     }
 
-    // Función helper para crear un parser desde un string
+    // Función helper para crear un parser desde un string. El stream queda
+    // en el fixture y mantiene vivos sus tokens aunque el lexer ya no exista
     std::unique_ptr<RecursiveDescendant> createParser(const std::string& content) {
         writeToTempFile(content);
         Lexer lexer(tempFile);
-        auto stream = lexer.generateStream();
-        return std::make_unique<RecursiveDescendant>(stream);
+        stream.reset(lexer.generateStream());
+        return std::make_unique<RecursiveDescendant>(stream.get());
     }
 
     std::string tempFile;
+    std::unique_ptr<TokenStream> stream;
 };
 
 // Test para verificar el parsing de una definición de clase simple
@@ -200,6 +206,495 @@ TEST_F(ParserTest, ParsesMultipleDefinitions) {
     EXPECT_NO_THROW(parser->parse());
 }
 
+// Test para verificar que el parser se puede reutilizar con otro stream
+TEST_F(ParserTest, ResetRebindsParser) {
+    Lexer lexer;
+    TokenStream stream;
+    RecursiveDescendant parser(nullptr);
+
+    lexer.resetText("class A:\n    def f(self):\n        pass\n");
+    lexer.generateStream(stream);
+    parser.reset(&stream);
+    EXPECT_NO_THROW(parser.parse());
+
+    lexer.resetText("class A\n    pass\n");
+    lexer.generateStream(stream);
+    parser.reset(&stream);
+    EXPECT_THROW(parser.parse(), std::runtime_error);
+
+    lexer.resetText("@staticmethod\ndef g(x):\n    return x\n");
+    lexer.generateStream(stream);
+    parser.reset(&stream);
+    EXPECT_NO_THROW(parser.parse());
+}
+
+// Test para verificar el outline de clases y métodos reconocidos
+TEST_F(ParserTest, RecordsOutline) {
+    Lexer lexer;
+    TokenStream stream;
+    RecursiveDescendant parser(nullptr);
+
+    lexer.resetText(
+        "class Shape(Base, Mixin):\n"
+        "    @abstractmethod\n"
+        "    def area(self, scale: float = 1.0) -> float:\n"
+        "        pass\n"
+        "\n"
+        "    @staticmethod\n"
+        "    def make(size, *args, **kwargs):\n"
+        "        pass\n");
+    lexer.generateStream(stream);
+    parser.reset(&stream);
+    ASSERT_NO_THROW(parser.parse());
+
+    const Outline& outline = parser.outline();
+    ASSERT_EQ(outline.classes.size(), 1u);
+    const ClassInfo& shape = outline.classes[0];
+    EXPECT_EQ(shape.name, "Shape");
+    EXPECT_EQ(shape.parents, (std::vector<std::string>{"Base", "Mixin"}));
+    ASSERT_EQ(shape.methods.size(), 2u);
+
+    const MethodInfo& area = shape.methods[0];
+    EXPECT_EQ(area.name, "area");
+    EXPECT_EQ(area.decorators, DECORATOR_ABSTRACTMETHOD);
+    EXPECT_EQ(area.return_type, outline.types->name("float"));
+    ASSERT_EQ(area.params.size(), 2u);
+    EXPECT_EQ(area.params[0].name, "self");
+    EXPECT_EQ(area.params[1].name, "scale");
+    EXPECT_EQ(area.params[1].type, outline.types->name("float"));
+    EXPECT_TRUE(area.params[1].has_default);
+
+    const MethodInfo& make = shape.methods[1];
+    EXPECT_EQ(make.decorators, DECORATOR_STATICMETHOD);
+    ASSERT_EQ(make.params.size(), 3u);
+    EXPECT_EQ(make.params[0].stars, 0);
+    EXPECT_EQ(make.params[1].name, "args");
+    EXPECT_EQ(make.params[1].stars, 1);
+    EXPECT_EQ(make.params[2].name, "kwargs");
+    EXPECT_EQ(make.params[2].stars, 2);
+    EXPECT_TRUE(outline.functions.empty());
+}
+
+// Test para verificar las anotaciones de tipos compuestas y que los tipos
+// iguales comparten un mismo nodo
+TEST_F(ParserTest, ParsesStructuredTypeHints) {
+    auto parser = createParser(
+        "class Node:\n"
+        "    def link(self, a: Optional[\"Node\"], b: dict[str, list[int]]) -> Union[int, None]:\n"
+        "        pass\n"
+        "\n"
+        "    def call(self, f: typing.Callable[[int, str], bool], rest: tuple[int, ...]) -> None:\n"
+        "        pass\n"
+        "\n"
+        "    def same(self, a: Union[None, Node], b: Optional[Union[str, None]]) -> dict[str, list[int]]:\n"
+        "        pass\n");
+    ASSERT_NO_THROW(parser->parse());
+    const std::vector<MethodInfo>& methods = parser->outline().classes.at(0).methods;
+    ASSERT_EQ(methods.size(), 3u);
+
+    EXPECT_EQ(methods[0].params[1].type->text, "Optional[Node]");
+    EXPECT_EQ(methods[0].params[2].type->text, "dict[str, list[int]]");
+    EXPECT_EQ(methods[0].return_type->text, "Optional[int]");
+    EXPECT_EQ(methods[1].params[1].type->text, "typing.Callable[[int, str], bool]");
+    EXPECT_EQ(methods[1].params[2].type->text, "tuple[int, ...]");
+    EXPECT_EQ(methods[1].return_type, parser->outline().types->name("None"));
+
+    // Optional, Union y las referencias en strings se normalizan al mismo nodo
+    EXPECT_EQ(methods[2].params[1].type, methods[0].params[1].type);
+    EXPECT_EQ(methods[2].return_type, methods[0].params[2].type);
+    EXPECT_EQ(methods[2].params[2].type->text, "Optional[str]");
+    EXPECT_NE(methods[2].params[2].type, methods[0].return_type);
+
+    EXPECT_THROW(createParser("def f(self, x: list[int):\n    pass\n")->parse(), std::runtime_error);
+    EXPECT_THROW(createParser("def f(self, x: dict[]):\n    pass\n")->parse(), std::runtime_error);
+    EXPECT_THROW(createParser("def f(self) -> a.:\n    pass\n")->parse(), std::runtime_error);
+}
+
+// Test para verificar que cada outline tiene su propia tabla de tipos y que
+// los tipos de tablas distintas se comparan por estructura
+TEST_F(ParserTest, ComparesTypesAcrossOutlines) {
+    std::string code =
+        "class A:\n"
+        "    def f(self, a: Optional[dict[str, \"A\"]], b: int) -> tuple[int, ...]:\n"
+        "        pass\n";
+    auto first = createParser(code);
+    ASSERT_NO_THROW(first->parse());
+    Outline kept = first->outline();
+    auto second = createParser(code);
+    ASSERT_NO_THROW(second->parse());
+    const MethodInfo& a = kept.classes.at(0).methods.at(0);
+    const MethodInfo& b = second->outline().classes.at(0).methods.at(0);
+
+    EXPECT_NE(kept.types, second->outline().types);
+    EXPECT_NE(a.params[1].type, b.params[1].type);
+    EXPECT_TRUE(sameType(a.params[1].type, b.params[1].type));
+    EXPECT_TRUE(sameType(a.return_type, b.return_type));
+    EXPECT_FALSE(sameType(a.params[1].type, b.params[2].type));
+    EXPECT_FALSE(sameType(a.params[1].type, b.params[1].type->args[0]));
+
+    // Sin anotaciones no se crea la tabla
+    auto plain = createParser("class A:\n    def f(self):\n        pass\n");
+    ASSERT_NO_THROW(plain->parse());
+    EXPECT_EQ(plain->outline().types, nullptr);
+
+    // La copia del outline mantiene vivos sus nodos sin el parser
+    first.reset();
+    EXPECT_EQ(a.params[1].type->text, "Optional[dict[str, A]]");
+
+    // Adoptados en una tabla común, los tipos iguales son el mismo nodo
+    auto shared = std::make_shared<TypeTable>();
+    Outline other = second->outline();
+    adoptTypes(kept, shared);
+    adoptTypes(other, shared);
+    const MethodInfo& c = other.classes.at(0).methods.at(0);
+    EXPECT_EQ(kept.types, shared);
+    EXPECT_EQ(a.params[1].type, c.params[1].type);
+    EXPECT_EQ(a.return_type, c.return_type);
+    EXPECT_NE(a.params[1].type, c.params[2].type);
+    EXPECT_EQ(c.params[1].type->text, "Optional[dict[str, A]]");
+    EXPECT_EQ(c.return_type->text, "tuple[int, ...]");
+}
+
+// Test para verificar los formatos de salida del outline
+TEST_F(ParserTest, EmitsOutline) {
+    std::string code =
+        "class A(B):\n"
+        "    @property\n"
+        "    def size(self) -> int:\n"
+        "        pass\n"
+        "\n"
+        "@staticmethod\n"
+        "def f(x: str = \"q\", **rest):\n"
+        "    pass\n";
+    auto parser = createParser(code);
+    ASSERT_NO_THROW(parser->parse());
+
+    std::string out;
+    emitOutline(parser->outline(), out);
+    EXPECT_EQ(out,
+        "class A(B)\n"
+        "    @property\n"
+        "    def size(self) -> int\n"
+        "@staticmethod\n"
+        "def f(x: str = ..., **rest)\n");
+
+    out.clear();
+    emitJson("a\"b.py", parser->outline(), "", out);
+    EXPECT_EQ(out,
+        "{\"file\":\"a\\\"b.py\",\"classes\":[{\"name\":\"A\",\"parents\":[\"B\"],\"methods\":["
+        "{\"name\":\"size\",\"decorators\":[\"property\"],\"params\":[{\"name\":\"self\"}],\"returns\":\"int\"}]}],"
+        "\"functions\":[{\"name\":\"f\",\"decorators\":[\"staticmethod\"],\"params\":["
+        "{\"name\":\"x\",\"type\":\"str\",\"default\":true},{\"name\":\"rest\",\"stars\":2}]}]}\n");
+}
+
+// Acepta o rechaza el stream con los tres motores: recursive descent, LALR
+// (bison) y LL(1) por tabla. Devuelve "accept"/"reject" por motor
+static std::string parseWithEngines(TokenStream& stream) {
+    RecursiveDescendant recursive(nullptr);
+    LalrParser lalr(nullptr);
+    LL1Parser ll1(nullptr);
+    Parser* engines[] = {&recursive, &lalr, &ll1};
+    std::string result;
+    for (Parser* engine : engines) {
+        engine->reset(&stream);
+        try {
+            engine->parse();
+            result += "accept ";
+        } catch (const std::runtime_error&) {
+            result += "reject ";
+        }
+    }
+    return result;
+}
+
+// Test para verificar que los tres motores aceptan y rechazan lo mismo
+TEST_F(ParserTest, EnginesAgreeOnExamples) {
+    struct Case {
+        const char* code;
+        bool valid;
+    };
+    const Case cases[] = {
+        {"class A:\n    def __init__(self):\n        pass\n", true},
+        {"import os\nx = 1\nclass A(B, C):\n    pass\n", false},
+        {"import os\nclass A(B, C):\n    @classmethod\n    def f(cls, *a, **k) -> int:\n        return 1\n", true},
+        {"@staticmethod\ndef f(x: int = -1, y=3):\n    if x:\n        return y\n", true},
+        // El valor por defecto termina en la primera coma, aunque esté entre paréntesis
+        {"@staticmethod\ndef f(x: int = (1, 2), y=3):\n    pass\n", false},
+        {"@staticmethod\ndef f(*x):\n    pass\n", false},
+        {"class A:\n    def f(self):\n        pass\nx = 1\nclass B:\n    pass\n", true},
+        {"class A:\n\n", false},
+        {"def f(self, a: int = 1, b):\n    pass\n", true},
+        {"x = 1\n", false},
+        {"", false},
+        {"class A\n    pass\n", false},
+        {"def f(self):\n    for i in x:\n        while y:\n            pass\n", true},
+        {"def f(self, x: Optional[dict[str, 'A']] = None) -> typing.Tuple[int, ...]:\n    pass\n", true},
+        {"def f(self, g: Callable[[], None]) -> list[int, [str, x.y]]:\n    pass\n", true},
+        {"def f(self, x: list[]):\n    pass\n", false},
+        {"def f(self, x: list[int,]):\n    pass\n", false},
+    };
+    Lexer lexer;
+    TokenStream stream;
+    for (const Case& c : cases) {
+        lexer.resetText(c.code);
+        lexer.generateStream(stream);
+        EXPECT_EQ(parseWithEngines(stream), c.valid ? "accept accept accept " : "reject reject reject ") << c.code;
+    }
+}
+
+// Test para verificar que los motores coinciden en streams de tokens al azar,
+// armados con trozos de definiciones para que parte de ellos sea válida
+TEST_F(ParserTest, EnginesAgreeOnRandomTokenStreams) {
+    using T = Tag;
+    const std::vector<std::vector<T>> pieces = {
+        {T::CLASS, T::VARIABLE, T::COLON, T::NEWLINE, T::INDENT},
+        {T::CLASS, T::VARIABLE, T::OPEN_PARENTHESIS, T::VARIABLE, T::CLOSE_PARENTHESIS, T::COLON, T::NEWLINE, T::INDENT},
+        {T::DEF, T::VARIABLE, T::OPEN_PARENTHESIS, T::SELF},
+        {T::DEF, T::INIT, T::OPEN_PARENTHESIS, T::SELF},
+        {T::DEF, T::VARIABLE, T::OPEN_PARENTHESIS, T::CLS},
+        {T::DEF, T::VARIABLE, T::OPEN_PARENTHESIS, T::VARIABLE},
+        {T::PROPERTY, T::NEWLINE}, {T::STATICMETHOD, T::NEWLINE}, {T::CLASSMETHOD, T::NEWLINE},
+        {T::COMMA, T::VARIABLE}, {T::COMMA, T::MULT, T::VARIABLE}, {T::COMMA, T::MULT, T::MULT, T::VARIABLE},
+        {T::COLON, T::TYPE}, {T::ASSIGN, T::NUM}, {T::ARROW, T::TYPE},
+        {T::COLON, T::VARIABLE, T::DOT, T::VARIABLE}, {T::OPEN_BRACKET, T::TYPE}, {T::CLOSE_BRACKET},
+        {T::COMMA, T::NONE}, {T::DOT, T::DOT, T::DOT},
+        {T::CLOSE_PARENTHESIS, T::COLON, T::NEWLINE, T::INDENT},
+        {T::PASS, T::NEWLINE}, {T::RETURN, T::VARIABLE, T::NEWLINE},
+        {T::IF, T::VARIABLE, T::COLON, T::NEWLINE, T::INDENT},
+        {T::DEDENT}, {T::DEDENT}, {T::DEDENT},
+    };
+    std::mt19937 rng(7);
+    size_t accepted = 0;
+    for (int i = 0; i < 3000; i++) {
+        TokenStream stream;
+        int count = std::uniform_int_distribution<int>(1, 12)(rng);
+        for (int p = 0; p < count; p++) {
+            if (rng() % 8 == 0) {
+                stream.add(stream.make<Token>(static_cast<int>(rng() % TAG_COUNT)));
+                continue;
+            }
+            for (T tag : pieces[rng() % pieces.size()]) {
+                stream.add(stream.make<Token>(static_cast<int>(tag)));
+            }
+        }
+        std::string result = parseWithEngines(stream);
+        ASSERT_TRUE(result == "accept accept accept " || result == "reject reject reject ") << "stream " << i;
+        accepted += result[0] == 'a';
+    }
+    // Sin aceptados la prueba no diría nada
+    EXPECT_GT(accepted, 0u);
+}
+
+// Árbol del cuerpo de la única función de code, parseando los cuerpos
+static std::string parseBody(const std::string& code) {
+    Lexer lexer;
+    lexer.resetText(code);
+    TokenStream stream;
+    lexer.generateStream(stream);
+    RecursiveDescendant parser(&stream);
+    parser.setParseBodies(true);
+    parser.parse();
+    const Outline& outline = parser.outline();
+    return dumpAst(outline.ast, outline.functions.at(0).body, stream);
+}
+
+static std::string functionBody(const std::string& body) {
+    return "def f(self):\n" + body;
+}
+
+// Test para verificar la precedencia y asociatividad de las expresiones
+TEST_F(ParserTest, ParsesBodyExpressions) {
+    EXPECT_EQ(parseBody(functionBody("    return a + b * c ** -d ** e\n")),
+              "(Body (Return (Binary + (Name a) (Binary * (Name b) "
+              "(Binary ** (Name c) (Unary - (Binary ** (Name d) (Name e))))))))");
+    EXPECT_EQ(parseBody(functionBody("    x = not a < b and c or d if e else f\n")),
+              "(Body (Assign (Name x) (IfExp (BoolOp or (BoolOp and (Unary not (Compare < (Name a) (Name b))) "
+              "(Name c)) (Name d)) (Name e) (Name f))))");
+    EXPECT_EQ(parseBody(functionBody("    a - b - c // d << 1\n")),
+              "(Body (Expression (Binary << (Binary - (Binary - (Name a) (Name b)) "
+              "(Binary // (Name c) (Name d))) (Number 1))))");
+    EXPECT_EQ(parseBody(functionBody("    a is not b not in c\n")),
+              "(Body (Expression (Compare not in (Compare is not (Name a) (Name b)) (Name c))))");
+    EXPECT_EQ(parseBody(functionBody("    self.x[1:, ::2](*a, k=v, **kw).y\n")),
+              "(Body (Expression (Attribute y (Call (Subscript (Attribute x (Name self)) "
+              "(Tuple (Slice (Number 1) (Empty) (Empty)) (Slice (Empty) (Empty) (Number 2)))) "
+              "(Starred * (Name a)) (Keyword k (Name v)) (Starred ** (Name kw))))))");
+    EXPECT_EQ(parseBody(functionBody("    return [x for x in y if x], {k: v for k, v in d}, {1, *s}, {**m}, ()\n")),
+              "(Body (Return (Tuple (ListComp (Name x) (ComprehensionFor (Name x) (Name y) (Name x))) "
+              "(DictComp (Name k) (Name v) (ComprehensionFor (Tuple (Name k) (Name v)) (Name d))) "
+              "(Set (Number 1) (Starred * (Name s))) (Dict (Empty) (Name m)) (Tuple))))");
+    EXPECT_EQ(parseBody(functionBody("    f = lambda a, *b, c=1: (yield) if a else f'{b}' 'c'\n")),
+              "(Body (Assign (Name f) (Lambda (Parameter a (Empty)) (Parameter * b (Empty)) "
+              "(Parameter c (Empty) (Number 1)) (IfExp (Yield) (Name a) (String \"{b}\")))))");
+}
+
+// Test para verificar las sentencias de los cuerpos
+TEST_F(ParserTest, ParsesBodyStatements) {
+    std::string code = functionBody(
+        "    for i, x in enumerate(xs):\n"
+        "        if x: continue\n"
+        "        elif i:\n"
+        "            x **= 2\n"
+        "        else:\n"
+        "            break\n"
+        "    else:\n"
+        "        pass\n"
+        "    try:\n"
+        "        import a.b as c\n"
+        "    except E as e:\n"
+        "        raise F from e\n"
+        "    finally:\n"
+        "        del x\n"
+        "    with open(p) as f:\n"
+        "        from .m import (y, z as w)\n"
+        "    n: int = 0\n");
+    EXPECT_EQ(parseBody(code),
+              "(Body (For (Tuple (Name i) (Name x)) (Call (Name enumerate) (Name xs)) "
+              "(Body (If (Name x) (Body (Continue)) (If (Name i) (Body (AugAssign ** (Name x) (Number 2))) "
+              "(Body (Break))))) (Body (Pass))) "
+              "(Try (Body (Import (Alias (Attribute b (Name a)) (Name c)))) "
+              "(Handler (Name E) (Name e) (Body (Raise (Name F) (Name e)))) (Empty) (Body (Delete (Name x)))) "
+              "(With (WithItem (Call (Name open) (Name p)) (Name f)) "
+              "(Body (ImportFrom (Name m) (Alias (Name y)) (Alias (Name z) (Name w))))) "
+              "(AnnAssign (Name n) (Name int) (Number 0)))");
+
+    // Funciones y clases anidadas se parsean enteras
+    EXPECT_EQ(parseBody(functionBody(
+                  "    @cache\n"
+                  "    def g(a: int, *, b=2) -> str:\n"
+                  "        class C(Base, metaclass=M):\n"
+                  "            x = 1\n"
+                  "        return C\n"
+                  "    return g\n")),
+              "(Body (FunctionDef g (Name @cache) (Parameter a (Name int)) (Parameter * (Empty)) "
+              "(Parameter b (Empty) (Number 2)) (Name str) (Body (ClassDef C (Name Base) "
+              "(Keyword metaclass (Name M)) (Body (Assign (Name x) (Number 1)))) (Return (Name C)))) "
+              "(Return (Name g)))");
+}
+
+// Test para verificar que dentro de paréntesis los saltos de línea y la
+// indentación no cuentan
+TEST_F(ParserTest, ParsesBodiesAcrossLines) {
+    std::string code = functionBody(
+        "    x = f(a,\n"
+        "            b)\n"
+        "    if (a or\n"
+        "        b):\n"
+        "        return [1,\n"
+        "    2]\n"
+        "    return x\n");
+    EXPECT_EQ(parseBody(code),
+              "(Body (Assign (Name x) (Call (Name f) (Name a) (Name b))) "
+              "(If (BoolOp or (Name a) (Name b)) (Body (Return (List (Number 1) (Number 2))))) "
+              "(Return (Name x)))");
+}
+
+// Test para verificar que los cuerpos inválidos se rechazan, y que sin
+// setParseBodies se siguen saltando
+TEST_F(ParserTest, RejectsInvalidBodies) {
+    const char* const bodies[] = {
+        "    return a +\n",
+        "    x = (1, 2\n",
+        "    if x\n        pass\n",
+        "    f(a b)\n",
+        "    x = yield yield\n",
+        "    self.lambda = 1\n",
+        "    try:\n        pass\n",
+        "    for x y in z:\n        pass\n",
+        "    else:\n        pass\n",
+        "    x = [1, 2]]\n",
+        "    x = 1 if y\n",
+        // Destinos que no son asignables
+        "    x + 1 = 2\n",
+        "    f() = 1\n",
+        "    a = b = f() = 1\n",
+        "    x = yield = 1\n",
+        "    a, *(*b) = c\n",
+        "    del f()\n",
+        "    del a + b\n",
+        "    del [a, *b]\n",
+        "    a, b += 1\n",
+        "    (a, b) += 1\n",
+        "    a, b: int\n",
+        "    for f() in z:\n        pass\n",
+        "    with a as f():\n        pass\n",
+        "    x = [1 for f() in y]\n",
+        // Orden de los argumentos y desempaquetado en comprensiones
+        "    f(a=1, b)\n",
+        "    f(**a, b)\n",
+        "    f(**a, *b)\n",
+        "    f(a for a in b, c)\n",
+        "    f(c, a for a in b)\n",
+        "    f(a for a in b,)\n",
+        "    class C(a for a in b):\n        pass\n",
+        "    x = [*a for a in b]\n",
+        "    x = {**a for a in b}\n",
+        "    x = (*a for a in b)\n",
+    };
+    for (const char* body : bodies) {
+        std::string code = functionBody(body);
+        EXPECT_THROW(parseBody(code), std::runtime_error) << body;
+
+        auto parser = createParser(code);
+        EXPECT_NO_THROW(parser->parse()) << body;
+    }
+}
+
+// Test para verificar los destinos y argumentos que Python sí acepta
+TEST_F(ParserTest, AcceptsValidTargetsAndArguments) {
+    EXPECT_EQ(parseBody(functionBody("    (a).b, c[0], *[d, e] = x = yield\n")),
+              "(Body (Assign (Tuple (Attribute b (Name a)) (Subscript (Name c) (Number 0)) "
+              "(Starred * (List (Name d) (Name e)))) (Name x) (Yield)))");
+    EXPECT_EQ(parseBody(functionBody("    del (a), [b.c, d[1]]\n")),
+              "(Body (Delete (Name a) (List (Attribute c (Name b)) (Subscript (Name d) (Number 1)))))");
+    EXPECT_EQ(parseBody(functionBody("    with f() as (a, *b):\n        c[0] += 1\n")),
+              "(Body (With (WithItem (Call (Name f)) (Tuple (Name a) (Starred * (Name b)))) "
+              "(Body (AugAssign + (Subscript (Name c) (Number 0)) (Number 1)))))");
+    EXPECT_EQ(parseBody(functionBody("    f(a, *b, c=1, *d, **e, g=2)\n")),
+              "(Body (Expression (Call (Name f) (Name a) (Starred * (Name b)) (Keyword c (Number 1)) "
+              "(Starred * (Name d)) (Starred ** (Name e)) (Keyword g (Number 2)))))");
+    EXPECT_EQ(parseBody(functionBody("    return g(x for x, in y), [x for *x, y in z]\n")),
+              "(Body (Return (Tuple (Call (Name g) (Generator (Name x) (ComprehensionFor (Tuple (Name x)) (Name y)))) "
+              "(ListComp (Name x) (ComprehensionFor (Tuple (Starred * (Name x)) (Name y)) (Name z))))))");
+}
+
+// Test para verificar que se registran los imports de nivel superior
+TEST_F(ParserTest, RecordsImports) {
+    auto parser = createParser(
+        "import os.path as p, sys\n"
+        "from ..pkg.mod import (a,\n"
+        "    b as c,\n"
+        ")\n"
+        "from . import *\n"
+        "try:\n"
+        "    import json\n"
+        "except ImportError:\n"
+        "    json = None\n"
+        "class A(B):\n"
+        "    def f(self):\n"
+        "        import inner\n"
+        "x = 1\n"
+        "from late import z\n");
+    ASSERT_NO_THROW(parser->parse());
+
+    const std::vector<ImportInfo>& imports = parser->outline().imports;
+    ASSERT_EQ(imports.size(), 6u);
+    EXPECT_EQ(imports[0].module, "os.path");
+    EXPECT_EQ(imports[1].module, "sys");
+    EXPECT_TRUE(imports[1].names.empty());
+    EXPECT_EQ(imports[2].module, "pkg.mod");
+    EXPECT_EQ(imports[2].level, 2);
+    using Names = std::vector<std::pair<std::string, std::string>>;
+    EXPECT_EQ(imports[2].names, (Names{{"a", "a"}, {"b", "c"}}));
+    EXPECT_EQ(imports[3].module, "");
+    EXPECT_EQ(imports[3].level, 1);
+    EXPECT_EQ(imports[3].names, (Names{{"*", "*"}}));
+    // Los imports dentro de bloques cuentan; los de los métodos no
+    EXPECT_EQ(imports[4].module, "json");
+    EXPECT_EQ(imports[5].module, "late");
+    EXPECT_EQ(imports[5].names, (Names{{"z", "z"}}));
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
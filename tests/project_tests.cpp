@@ -0,0 +1,231 @@
+#include <gtest/gtest.h>
+#include "Project.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Fixture para las pruebas del análisis de proyectos
+class ProjectTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::filesystem::remove_all(root);
+    }
+
+    void writeFile(const std::string& name, const std::string& content) {
+        std::filesystem::path path = std::filesystem::path(root) / name;
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream file(path);
+        file << content;
+    }
+
+    // Nombres de los módulos que importa el módulo dado
+    std::vector<std::string> importsOf(const Project& project, const std::string& name) {
+        std::vector<std::string> names;
+        int64_t id = project.find(name);
+        if (id < 0) {
+            return names;
+        }
+        for (uint32_t dependency : project.modules()[id].imports) {
+            names.push_back(project.modules()[dependency].name);
+        }
+        return names;
+    }
+
+    // Diagnósticos del módulo dado como texto
+    std::vector<std::string> diagnosticsOf(const Project& project, const std::string& name) {
+        std::vector<std::string> messages;
+        int64_t id = project.find(name);
+        if (id < 0) {
+            return messages;
+        }
+        for (const Diagnostic& diagnostic : project.modules()[id].diagnostics) {
+            messages.push_back(diagnostic.toString());
+        }
+        return messages;
+    }
+
+    std::string root = "temp_project";
+};
+
+// Test para verificar los nombres de los módulos y la resolución de imports
+TEST_F(ProjectTest, ResolvesImports) {
+    writeFile("app.py", "import pkg.shapes\nfrom pkg import util\nimport os\n");
+    writeFile("pkg/__init__.py", "from .shapes import *\n");
+    writeFile("pkg/shapes.py", "from . import util\nfrom .. import app\nfrom ... import nothing\n");
+    writeFile("pkg/util.py", "from .sub.deep import x\nimport pkg\n");
+    writeFile("pkg/sub/deep.py", "from ..util import y\nfrom ... import app\n");
+
+    Project project;
+    project.addRoot(root);
+    project.analyze(1);
+
+    ASSERT_EQ(project.modules().size(), 5u);
+    ASSERT_GE(project.find("pkg"), 0);
+    EXPECT_TRUE(project.modules()[project.find("pkg")].package);
+    EXPECT_EQ(project.find("os"), -1);
+
+    EXPECT_EQ(importsOf(project, "app"), (std::vector<std::string>{"pkg", "pkg.shapes", "pkg.util"}));
+    EXPECT_EQ(importsOf(project, "pkg"), (std::vector<std::string>{"pkg.shapes"}));
+    // "from . import util" también importa el paquete; "from .. import app"
+    // sube a la raíz y "from ... import" se sale de ella
+    EXPECT_EQ(importsOf(project, "pkg.shapes"), (std::vector<std::string>{"app", "pkg", "pkg.util"}));
+    EXPECT_EQ(importsOf(project, "pkg.util"), (std::vector<std::string>{"pkg", "pkg.sub.deep"}));
+    EXPECT_EQ(importsOf(project, "pkg.sub.deep"), (std::vector<std::string>{"app", "pkg.util"}));
+}
+
+// Test para verificar que cada módulo se comprueba después de lo que importa
+TEST_F(ProjectTest, ChecksInDependencyOrder) {
+    // Una cadena y un árbol de módulos sin ciclos
+    for (int i = 0; i < 20; i++) {
+        std::string code;
+        if (i > 0) {
+            code += "from m" + std::to_string(i - 1) + " import C" + std::to_string(i - 1) + "\n";
+        }
+        if (i > 1) {
+            code += "import m" + std::to_string(i / 2) + "\n";
+        }
+        code += "class C" + std::to_string(i) + ":\n    def f(self):\n        pass\n";
+        writeFile("m" + std::to_string(i) + ".py", code);
+    }
+
+    for (unsigned threads : {1u, 4u}) {
+        Project project;
+        project.addRoot(root);
+        project.analyze(threads);
+        const std::vector<uint32_t>& order = project.order();
+        ASSERT_EQ(order.size(), 20u) << threads;
+
+        std::vector<size_t> position(order.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            position[order[i]] = i;
+        }
+        for (uint32_t id = 0; id < project.modules().size(); id++) {
+            for (uint32_t dependency : project.modules()[id].imports) {
+                EXPECT_LT(position[dependency], position[id]) << threads;
+            }
+        }
+    }
+}
+
+// Test para verificar los diagnósticos con clases base de otros módulos
+TEST_F(ProjectTest, ChecksAcrossModules) {
+    writeFile("shapes/base.py",
+        "class Shape:\n"
+        "    @abstractmethod\n"
+        "    def area(self):\n"
+        "        pass\n"
+        "\n"
+        "    def scale(self, factor):\n"
+        "        pass\n");
+    writeFile("shapes/__init__.py", "from .base import Shape as Base\n");
+    writeFile("square.py",
+        "from shapes.base import Shape\n"
+        "\n"
+        "class Square(Shape):\n"
+        "    def area(self):\n"
+        "        return 1\n");
+    writeFile("circle.py",
+        "from shapes import Base\n"
+        "\n"
+        "class Circle(Base):\n"
+        "    def scale(self):\n"
+        "        pass\n");
+    writeFile("local.py",
+        "from shapes.base import *\n"
+        "\n"
+        "class Shape:\n"
+        "    pass\n"
+        "\n"
+        "class Dot(Shape):\n"
+        "    pass\n");
+
+    Project project;
+    project.addRoot(root);
+    project.analyze(2);
+
+    EXPECT_TRUE(diagnosticsOf(project, "square").empty());
+    // El import pasa por el __init__ del paquete, que lo renombra
+    std::vector<std::string> circle = diagnosticsOf(project, "circle");
+    ASSERT_EQ(circle.size(), 2u);
+    EXPECT_EQ(circle[0],
+        "override-arity: Circle.scale takes 0 parameters but overrides Shape.scale which takes 1");
+    EXPECT_EQ(circle[1], "unimplemented-abstract: Circle does not implement abstract method Shape.area");
+    // Una clase del propio módulo oculta a la importada con el mismo nombre
+    EXPECT_TRUE(diagnosticsOf(project, "local").empty());
+}
+
+// Test para verificar que las anotaciones de todos los módulos comparten
+// una tabla de tipos, así que los tipos iguales son el mismo nodo
+TEST_F(ProjectTest, SharesTypesAcrossModules) {
+    writeFile("base.py",
+        "class Base:\n"
+        "    def get(self, key: dict[str, int]) -> Optional[int]:\n"
+        "        pass\n");
+    writeFile("same.py",
+        "from base import Base\n"
+        "\n"
+        "class Same(Base):\n"
+        "    def get(self, key: dict[str, int]) -> Optional[int]:\n"
+        "        pass\n");
+    writeFile("other.py",
+        "from base import Base\n"
+        "\n"
+        "class Other(Base):\n"
+        "    def get(self, key: dict[str, int]) -> str:\n"
+        "        pass\n");
+
+    Project project;
+    project.addRoot(root);
+    project.analyze(2);
+
+    const MethodInfo& base = project.modules()[project.find("base")].outline.classes.at(0).methods.at(0);
+    const Outline& same = project.modules()[project.find("same")].outline;
+    const MethodInfo& other = project.modules()[project.find("other")].outline.classes.at(0).methods.at(0);
+    EXPECT_EQ(same.types, project.modules()[project.find("base")].outline.types);
+    EXPECT_EQ(base.params[1].type, same.classes.at(0).methods.at(0).params[1].type);
+    EXPECT_EQ(base.return_type, same.classes.at(0).methods.at(0).return_type);
+    EXPECT_EQ(base.params[1].type, other.params[1].type);
+    EXPECT_NE(base.return_type, other.return_type);
+
+    EXPECT_TRUE(diagnosticsOf(project, "same").empty());
+    std::vector<std::string> diagnostics = diagnosticsOf(project, "other");
+    ASSERT_EQ(diagnostics.size(), 1u);
+    EXPECT_EQ(diagnostics[0].rfind("override-type: ", 0), 0u);
+}
+
+// Test para verificar que un ciclo de imports no bloquea el análisis
+TEST_F(ProjectTest, HandlesImportCycles) {
+    writeFile("a.py",
+        "from b import B\n"
+        "\n"
+        "class A:\n"
+        "    @abstractmethod\n"
+        "    def run(self):\n"
+        "        pass\n");
+    writeFile("b.py",
+        "from a import A\n"
+        "\n"
+        "class B(A):\n"
+        "    pass\n");
+    writeFile("c.py", "from b import B\n");
+    writeFile("broken.py", "class Broken(A)\n    pass\n");
+
+    for (unsigned threads : {1u, 3u}) {
+        Project project;
+        project.addRoot(root);
+        project.analyze(threads);
+        EXPECT_EQ(project.order().size(), 4u) << threads;
+        // El ciclo se comprueba empezando por el primer módulo, así que b ve A
+        EXPECT_EQ(diagnosticsOf(project, "b"),
+                  (std::vector<std::string>{"unimplemented-abstract: B does not implement abstract method A.run"}))
+            << threads;
+        EXPECT_FALSE(project.modules()[project.find("broken")].error.empty());
+    }
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+#include "Lexer.h"
+#include "RecursiveDescendant.h"
+#include "SemanticAnalyzer.h"
+#include <string>
+#include <vector>
+
+// Fixture para las pruebas del análisis semántico
+class SemanticTest : public ::testing::Test {
+protected:
+    // Parsea el código y devuelve los diagnósticos como texto
+    std::vector<std::string> analyze(const std::string& code) {
+        lexer.resetText(code);
+        lexer.generateStream(stream);
+        parser.reset(&stream);
+        parser.parse();
+        std::vector<std::string> messages;
+        for (const Diagnostic& diagnostic : analyzer.analyze(parser.outline())) {
+            messages.push_back(diagnostic.toString());
+        }
+        return messages;
+    }
+
+    Lexer lexer;
+    TokenStream stream;
+    RecursiveDescendant parser{nullptr};
+    SemanticAnalyzer analyzer;
+};
+
+// Test para verificar que una jerarquía correcta no da diagnósticos
+TEST_F(SemanticTest, AcceptsValidHierarchy) {
+    std::string code =
+        "class Shape:\n"
+        "    @abstractmethod\n"
+        "    def area(self, scale: float) -> float:\n"
+        "        pass\n"
+        "\n"
+        "class Square(Shape, ABC):\n"
+        "    def __init__(self, side):\n"
+        "        self.side = side\n"
+        "\n"
+        "    def area(self, scale, rounded=False):\n"
+        "        return self.side * scale\n"
+        "\n"
+        "    @property\n"
+        "    def name(self):\n"
+        "        return 'square'\n";
+    EXPECT_TRUE(analyze(code).empty());
+}
+
+// Test para verificar métodos abstractos sin implementar
+TEST_F(SemanticTest, ReportsUnimplementedAbstract) {
+    std::string code =
+        "class Shape:\n"
+        "    @abstractmethod\n"
+        "    def area(self):\n"
+        "        pass\n"
+        "\n"
+        "    @abstractmethod\n"
+        "    def name(self):\n"
+        "        pass\n"
+        "\n"
+        "class Polygon(Shape):\n"
+        "    def area(self):\n"
+        "        return 0\n"
+        "\n"
+        "class Square(Polygon):\n"
+        "    def sides(self):\n"
+        "        return 4\n";
+    // Polygon tiene subclases, solo Square es concreta
+    EXPECT_EQ(analyze(code), (std::vector<std::string>{
+        "unimplemented-abstract: Square does not implement abstract method Shape.name"}));
+}
+
+// Test para verificar métodos duplicados y propiedades con parámetros
+TEST_F(SemanticTest, ReportsDuplicatesAndPropertyParameters) {
+    std::string code =
+        "class A:\n"
+        "    def f(self):\n"
+        "        pass\n"
+        "\n"
+        "    @property\n"
+        "    def size(self, unit):\n"
+        "        pass\n"
+        "\n"
+        "    def f(self, x):\n"
+        "        pass\n";
+    EXPECT_EQ(analyze(code), (std::vector<std::string>{
+        "property-with-parameters: property A.size takes parameters besides self",
+        "duplicate-method: A.f is defined more than once"}));
+}
+
+// Test para verificar la aridad de los métodos sobrescritos
+TEST_F(SemanticTest, ReportsOverrideArity) {
+    std::string code =
+        "class Base:\n"
+        "    def run(self, a, b=1):\n"
+        "        pass\n"
+        "\n"
+        "    def log(self, *args):\n"
+        "        pass\n"
+        "\n"
+        "    @staticmethod\n"
+        "    def make(a):\n"
+        "        pass\n"
+        "\n"
+        "class Child(Base):\n"
+        "    def run(self, a):\n"
+        "        pass\n"
+        "\n"
+        "    def log(self, message):\n"
+        "        pass\n"
+        "\n"
+        "    @classmethod\n"
+        "    def make(cls, a):\n"
+        "        pass\n";
+    EXPECT_EQ(analyze(code), (std::vector<std::string>{
+        "override-arity: Child.run takes 1 parameters but overrides Base.run which takes 1 to 2"}));
+}
+
+// Test para verificar los tipos de los métodos sobrescritos
+TEST_F(SemanticTest, ReportsOverrideTypes) {
+    std::string code =
+        "class Base:\n"
+        "    def scale(self, factor: int, unit: str) -> float:\n"
+        "        pass\n"
+        "\n"
+        "    def items(self, keys: list[str]) -> Optional[list[int]]:\n"
+        "        pass\n"
+        "\n"
+        "    def shape(self, other: Shape) -> Shape:\n"
+        "        pass\n"
+        "\n"
+        "class Child(Base):\n"
+        "    def scale(self, factor: float, unit: int) -> int:\n"
+        "        pass\n"
+        "\n"
+        "    def items(self, keys: list) -> Union[list[int], str]:\n"
+        "        pass\n"
+        "\n"
+        "    def shape(self, other: Square) -> Square:\n"
+        "        pass\n";
+    // Los parámetros pueden aceptar más y el retorno devolver menos; los
+    // tipos con clases no se comparan, pueden ser subclases
+    EXPECT_EQ(analyze(code), (std::vector<std::string>{
+        "override-type: Child.scale takes unit: int but overrides Base.scale which takes unit: str",
+        "override-type: Child.items returns Union[list[int], str] but overrides Base.items which returns "
+        "Optional[list[int]]"}));
+}
+
+// Test para verificar que la búsqueda en herencia múltiple sigue el MRO de
+// Python y visita una vez los ancestros comunes
+TEST_F(SemanticTest, LooksUpMethodsThroughDiamonds) {
+    std::string code =
+        "class A:\n"
+        "    def f(self):\n"
+        "        pass\n"
+        "\n"
+        "class B(A):\n"
+        "    def f(self, x=1):\n"
+        "        pass\n"
+        "\n"
+        "class C(A):\n"
+        "    @abstractmethod\n"
+        "    def g(self):\n"
+        "        pass\n"
+        "\n"
+        "class D(B, C):\n"
+        "    def f(self):\n"
+        "        pass\n";
+    EXPECT_EQ(analyze(code), (std::vector<std::string>{
+        "override-arity: D.f takes 0 parameters but overrides B.f which takes 0 to 1",
+        "unimplemented-abstract: D does not implement abstract method C.g"}));
+}
+
+// Test para verificar que un método de una rama hermana del diamante, que
+// va antes que el ancestro común en el MRO, implementa el abstracto y es el
+// que se sobrescribe
+TEST_F(SemanticTest, FollowsC3OrderThroughDiamonds) {
+    std::string code =
+        "class A:\n"
+        "    @abstractmethod\n"
+        "    def f(self):\n"
+        "        pass\n"
+        "\n"
+        "class B(A):\n"
+        "    def f(self):\n"
+        "        pass\n"
+        "\n"
+        "class C(A):\n"
+        "    def g(self):\n"
+        "        pass\n"
+        "\n"
+        "class D(C, B):\n"
+        "    def h(self):\n"
+        "        pass\n"
+        "\n"
+        "class E(C, B):\n"
+        "    def f(self, x):\n"
+        "        pass\n";
+    EXPECT_EQ(analyze(code), (std::vector<std::string>{
+        "override-arity: E.f takes 1 parameters but overrides B.f which takes 0"}));
+}
+
+// Test para verificar que una jerarquía muy profunda no desborda la pila
+// ni copia los métodos heredados en cada clase
+TEST_F(SemanticTest, HandlesDeepHierarchies) {
+    const int depth = 50000;
+    std::string code =
+        "class C0:\n"
+        "    @abstractmethod\n"
+        "    def area(self):\n"
+        "        pass\n"
+        "\n"
+        "    def f(self):\n"
+        "        pass\n";
+    for (int i = 1; i < depth; i++) {
+        code += "class C" + std::to_string(i) + "(C" + std::to_string(i - 1) + "):\n"
+                "    def m" + std::to_string(i) + "(self):\n"
+                "        pass\n";
+    }
+    code += "class Leaf(C" + std::to_string(depth - 1) + "):\n"
+            "    def f(self, x):\n"
+            "        pass\n";
+    EXPECT_EQ(analyze(code), (std::vector<std::string>{
+        "override-arity: Leaf.f takes 1 parameters but overrides C0.f which takes 0",
+        "unimplemented-abstract: Leaf does not implement abstract method C0.area"}));
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}